@@ -15,10 +15,10 @@
 #ifndef RMW_ICEORYX_CPP__ICEORYX_GET_TOPIC_ENDPOINT_INFO_HPP_
 #define RMW_ICEORYX_CPP__ICEORYX_GET_TOPIC_ENDPOINT_INFO_HPP_
 
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
-#include <tuple>
 
 #include "rcutils/types.h"
 
@@ -41,45 +41,34 @@ std::map<std::string, std::vector<std::string>> get_publisher_and_nodes();
 std::map<std::string, std::vector<std::string>> get_subscriber_and_nodes();
 
 /**
- * \brief    Get publisher node names of one topic
- * \param    topic_name
- * \return   std::tuple<std::string, std::vector<std::string>>
+ * \brief    Remember the actual QoS of a publisher of this process for the endpoint info
+ *           queries, the port introspection of iceoryx does not carry it
+ * \param    port_id the unique id of the iceoryx publisher port
+ * \param    qos the actual QoS of the publisher
  */
-std::tuple<std::string, std::vector<std::string>> get_publisher_end_info_of_topic(
-  const char * topic_name);
+void register_publisher_qos(uint64_t port_id, const rmw_qos_profile_t & qos);
 
 /**
- * \brief    Get  subscriber node names of one topic
- * \param    topic_name
- * \return   std::tuple<std::string, std::vector<std::string>>
+ * \brief    Forget the QoS which was added by register_publisher_qos
+ * \param    port_id the unique id of the iceoryx publisher port
  */
-std::tuple<std::string, std::vector<std::string>> get_subscriber_end_info_of_topic(
-  const char * topic_name);
+void unregister_publisher_qos(uint64_t port_id);
 
 /**
- * \brief     helper function to fill rmw structs
- * \param    rmw_topic_endpoint_info_array
- * \param    iceoryx_topic_endpoint_info_array
- * \param    allocator
+ * \brief    Fill the endpoint info of one topic from the endpoint records of the graph cache.
+ *           GIDs and QoS are only accurate for the publishers of this process, subscribers have
+ *           a zero GID and the publishers of other processes an unknown QoS.
+ * \param    rmw_topic_endpoint_info_array zero initialized array to fill
+ * \param    topic_name the name of the topic
+ * \param    endpoint_type RMW_ENDPOINT_PUBLISHER or RMW_ENDPOINT_SUBSCRIPTION
+ * \param    allocator allocator for the array and its strings
  * \return   rmw_ret_t
  */
 rmw_ret_t
-fill_rmw_publisher_end_info(
+fill_rmw_topic_endpoint_info(
   rmw_topic_endpoint_info_array_t * rmw_topic_endpoint_info_array,
-  const std::tuple<std::string, std::vector<std::string>> & iceoryx_topic_endpoint_info_array,
-  rcutils_allocator_t * allocator);
-
-/**
- * \brief     helper function to fill rmw structs
- * \param    rmw_topic_endpoint_info_array
- * \param    iceoryx_topic_endpoint_info_array
- * \param    allocator
- * \return   rmw_ret_t
- */
-rmw_ret_t
-fill_rmw_subscriber_end_info(
-  rmw_topic_endpoint_info_array_t * rmw_topic_endpoint_info_array,
-  const std::tuple<std::string, std::vector<std::string>> & iceoryx_topic_endpoint_info_array,
+  const char * topic_name,
+  rmw_endpoint_type_t endpoint_type,
   rcutils_allocator_t * allocator);
 
 }  // namespace rmw_iceoryx_cpp
@@ -0,0 +1,230 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_ICEORYX_CPP__ICEORYX_GRAPH_CACHE_HPP_
+#define RMW_ICEORYX_CPP__ICEORYX_GRAPH_CACHE_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/roudi/introspection_types.hpp"
+
+#include "rmw/qos_profiles.h"
+#include "rmw/types.h"
+
+namespace rmw_iceoryx_cpp
+{
+/// @brief Upper bound for waiting on the first sample of a RouDi introspection topic
+constexpr std::chrono::milliseconds INTROSPECTION_SAMPLE_TIMEOUT{1000};
+
+/// @brief Number of publishers and subscribers on one topic
+struct TopicEndpointCount
+{
+  size_t publishers_{0U};
+  size_t subscribers_{0U};
+};
+
+/// @brief One publisher or subscriber of a topic, prepared for an rmw_topic_endpoint_info_t
+struct TopicEndpointRecord
+{
+  std::string node_name_;
+  std::string node_namespace_;
+  /// @brief Interned by get_interned_name_n_type, never nullptr
+  std::shared_ptr<const std::string> type_name_;
+  /// @brief Unique id of the iceoryx port which is used as GID, 0 for subscribers as the
+  ///        introspection does not carry their id
+  uint64_t port_id_{0U};
+  /// @brief The introspection does not carry the QoS, it is only known for local publishers
+  rmw_qos_profile_t qos_ = rmw_qos_profile_unknown;
+};
+
+/// @brief Immutable view of the publishers and subscribers of the iceoryx system, built from
+///        one sample of the RouDi port introspection
+struct GraphSnapshot
+{
+  /// @brief Incremented with every snapshot the graph cache builds, 0 for an empty graph
+  uint64_t generation_{0U};
+  /// @brief ROS topic names and their types
+  std::map<std::string, std::string> names_n_types_;
+  /// @brief Full node names and the topics their subscriptions/publishers are on
+  std::map<std::string, std::vector<std::string>> subscribers_topics_;
+  std::map<std::string, std::vector<std::string>> publishers_topics_;
+  /// @brief Topics and the full names of the nodes subscribing/publishing to them
+  std::map<std::string, std::vector<std::string>> topic_subscribers_;
+  std::map<std::string, std::vector<std::string>> topic_publishers_;
+  /// @brief Endpoint counts per topic, so that counting is a single hash lookup
+  std::unordered_map<std::string, TopicEndpointCount> topic_endpoint_counts_;
+  /// @brief Endpoint records per topic, built once per snapshot for the endpoint info queries
+  std::unordered_map<std::string, std::vector<TopicEndpointRecord>> topic_publisher_records_;
+  std::unordered_map<std::string, std::vector<TopicEndpointRecord>> topic_subscriber_records_;
+
+  /// @return the endpoint counts of the topic, zero for an unknown topic
+  TopicEndpointCount count_endpoints(const std::string & topic_name) const
+  {
+    auto count = topic_endpoint_counts_.find(topic_name);
+    return (count == topic_endpoint_counts_.end()) ? TopicEndpointCount{} : count->second;
+  }
+};
+
+/// @brief A publisher or subscriber as ROS sees it, the iceoryx port behind it is not part of it
+struct GraphEndpoint
+{
+  enum class Kind : uint8_t
+  {
+    PUBLISHER,
+    SUBSCRIBER
+  };
+
+  Kind kind_{Kind::PUBLISHER};
+  std::string topic_name_;
+  std::string type_name_;
+  std::string node_name_;
+
+  bool operator<(const GraphEndpoint & rhs) const
+  {
+    return std::tie(kind_, topic_name_, type_name_, node_name_) <
+           std::tie(rhs.kind_, rhs.topic_name_, rhs.type_name_, rhs.node_name_);
+  }
+
+  bool operator==(const GraphEndpoint & rhs) const
+  {
+    return std::tie(kind_, topic_name_, type_name_, node_name_) ==
+           std::tie(rhs.kind_, rhs.topic_name_, rhs.type_name_, rhs.node_name_);
+  }
+};
+
+/// @brief The endpoints which appeared and disappeared between two introspection samples
+struct GraphChange
+{
+  /// @brief The value of the graph generation after this change was applied
+  uint64_t generation_{0U};
+  std::vector<GraphEndpoint> added_;
+  std::vector<GraphEndpoint> removed_;
+  /// @brief Publishers per topic after this change, set by the graph change notifier so that a
+  ///        consumer which is woken up by the change counts in the very same graph
+  std::unordered_map<std::string, size_t> topic_publisher_counts_;
+
+  bool empty() const
+  {
+    return added_.empty() && removed_.empty();
+  }
+
+  /// @return the publishers on the topic after this change, zero for an unknown topic
+  size_t count_publishers(const std::string & topic_name) const
+  {
+    auto count = topic_publisher_counts_.find(topic_name);
+    return (count == topic_publisher_counts_.end()) ? 0U : count->second;
+  }
+};
+
+/// Collect the ROS-visible endpoints of a port introspection sample.
+/**
+ * \param    port_sample the sample of the RouDi port introspection
+ * \return   the endpoints, sorted; an endpoint occurs once per iceoryx port
+ */
+std::vector<GraphEndpoint>
+collect_graph_endpoints(const iox::roudi::PortIntrospectionFieldTopic & port_sample);
+
+/// Diff two sorted endpoint lists as returned by collect_graph_endpoints.
+/**
+ * Endpoints are compared as multisets, hence a second publisher of the same node on the same
+ * topic is reported as added.
+ * \param    previous the endpoints of the previous sample
+ * \param    current the endpoints of the current sample
+ * \return   the change, its generation is left at 0
+ */
+GraphChange
+diff_graph_endpoints(
+  const std::vector<GraphEndpoint> & previous,
+  const std::vector<GraphEndpoint> & current);
+
+/// Count the publishers per topic of an endpoint list as returned by collect_graph_endpoints.
+/**
+ * \param    endpoints the endpoints of one sample
+ * \return   the number of publishers per topic, topics without a publisher are left out
+ */
+std::unordered_map<std::string, size_t>
+count_graph_publishers(const std::vector<GraphEndpoint> & endpoints);
+
+/// Build a graph snapshot from a port introspection sample.
+/**
+ * \param    port_sample the sample of the RouDi port introspection
+ * \return   the snapshot, its generation is left at 0
+ */
+GraphSnapshot
+build_graph_snapshot(const iox::roudi::PortIntrospectionFieldTopic & port_sample);
+
+/// Wait until a freshly subscribed introspection subscriber received its first sample.
+/**
+ * RouDi delivers the latest introspection sample on subscribe, usually within a few
+ * milliseconds. The subscriber is attached to a WaitSet for the duration of the call, hence it
+ * must not be attached to another WaitSet or Listener.
+ * \param    subscriber the subscriber to wait for
+ * \param    timeout the maximum time to wait
+ * \return   true if a sample is available, false on timeout
+ */
+bool
+wait_for_introspection_sample(
+  iox::popo::UntypedSubscriber & subscriber,
+  std::chrono::milliseconds timeout = INTROSPECTION_SAMPLE_TIMEOUT);
+
+/// Get the latest snapshot of the process-wide graph cache.
+/**
+ * The cache subscribes to the RouDi port introspection on first use and waits for the first
+ * sample for at most INTROSPECTION_SAMPLE_TIMEOUT. A new snapshot is built
+ * once per introspection sample and swapped in atomically; queries in between only load the
+ * current one. The snapshot is never modified, hence it can be read without copying as long
+ * as the pointer is held.
+ * \return   the latest snapshot
+ */
+std::shared_ptr<const GraphSnapshot>
+get_graph_snapshot();
+
+/// @brief Names and namespaces of all nodes of the iceoryx system, built from one sample of the
+///        RouDi process introspection
+struct NodeNamesSnapshot
+{
+  /// @brief Incremented with every snapshot the node names cache builds
+  uint64_t generation_{0U};
+  /// @brief Sorted by full name, the namespace of a node has the same index as its name
+  std::vector<std::string> node_names_;
+  std::vector<std::string> node_namespaces_;
+};
+
+/// Build a node names snapshot from a process introspection sample.
+/**
+ * \param    process_sample the sample of the RouDi process introspection
+ * \return   the snapshot, its generation is left at 0
+ */
+NodeNamesSnapshot
+build_node_names_snapshot(const iox::roudi::ProcessIntrospectionFieldTopic & process_sample);
+
+/// Get the latest snapshot of the process-wide node names cache.
+/**
+ * Like the graph cache, the node names cache subscribes to the RouDi process introspection on
+ * first use and parses the node names once per introspection sample.
+ * \return   the latest snapshot
+ */
+std::shared_ptr<const NodeNamesSnapshot>
+get_node_names_snapshot();
+
+}  // namespace rmw_iceoryx_cpp
+#endif  // RMW_ICEORYX_CPP__ICEORYX_GRAPH_CACHE_HPP_
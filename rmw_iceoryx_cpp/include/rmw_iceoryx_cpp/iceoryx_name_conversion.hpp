@@ -17,6 +17,7 @@
 #ifndef RMW_ICEORYX_CPP__ICEORYX_NAME_CONVERSION_HPP_
 #define RMW_ICEORYX_CPP__ICEORYX_NAME_CONVERSION_HPP_
 
+#include <memory>
 #include <string>
 #include <tuple>
 
@@ -54,6 +55,31 @@ get_name_n_type_from_service_description(
   const std::string & instance,
   const std::string & event);
 
+/// @brief ROS topic and type of an iceoryx service triplet as stored by the interning cache
+struct InternedNameNType
+{
+  std::string name_;
+  std::string type_;
+};
+
+/// Get the interned pair of ROS topic and type from a given iceoryx service triplet.
+/**
+ * The triplet is converted with get_name_n_type_from_service_description the first time it is
+ * seen, later calls return the stored result without any string processing. The cache is
+ * bounded by the number of ports RouDi holds at a time: once it is exceeded, the entries which
+ * are no longer referenced by any returned handle are removed.
+ * This function is thread-safe.
+ * \param service the iceoryx service description
+ * \param instance the iceoryx instance description
+ * \param event the iceoryx event description
+ * \return the interned topic and type, the same handle for the same triplet while it is held
+ */
+std::shared_ptr<const InternedNameNType>
+get_interned_name_n_type(
+  const iox::capro::IdString_t & service,
+  const iox::capro::IdString_t & instance,
+  const iox::capro::IdString_t & event);
+
 /// Get the iceoryx service triplet description from a given pair of ROS topic and type.
 /**
  * Given a pair in the form of topic name and type, generate a iceoryx service description triplet.
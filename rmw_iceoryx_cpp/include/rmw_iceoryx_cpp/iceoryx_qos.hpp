@@ -0,0 +1,77 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_ICEORYX_CPP__ICEORYX_QOS_HPP_
+#define RMW_ICEORYX_CPP__ICEORYX_QOS_HPP_
+
+#include <string>
+
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+
+#include "rmw/qos_profiles.h"
+#include "rmw/types.h"
+
+namespace rmw_iceoryx_cpp
+{
+/// Map a ROS QoS profile to the options of an iceoryx publisher.
+/**
+ * TRANSIENT_LOCAL durability is mapped to a history capacity of `depth` samples,
+ * RELIABLE reliability with KEEP_ALL history makes the publisher wait for subscribers which
+ * block their producers, which a ROS subscription never does.
+ * \param    qos_policies the QoS profile of the ROS publisher
+ * \param    node_full_name the full name of the node which creates the publisher
+ * \return   the iceoryx publisher options
+ */
+iox::popo::PublisherOptions
+get_iceoryx_publisher_options(
+  const rmw_qos_profile_t & qos_policies,
+  const std::string & node_full_name);
+
+/// Map a ROS QoS profile to the options of an iceoryx subscriber.
+/**
+ * The depth is clamped to the queue capacity iceoryx supports, TRANSIENT_LOCAL durability
+ * requests the publisher history. The subscriber always discards the oldest sample when its
+ * queue is full, also for RELIABLE reliability with KEEP_ALL history: iceoryx does not connect a
+ * blocking subscriber to a publisher which discards, e.g. one with the default profile, although
+ * ROS considers such a pair compatible.
+ * \param    qos_policies the QoS profile of the ROS subscription
+ * \param    node_full_name the full name of the node which creates the subscription
+ * \return   the iceoryx subscriber options
+ */
+iox::popo::SubscriberOptions
+get_iceoryx_subscriber_options(
+  const rmw_qos_profile_t & qos_policies,
+  const std::string & node_full_name);
+
+/// Check whether a publisher and a subscription can communicate as requested.
+/**
+ * Besides the checks of ROS, a KEEP_ALL subscription is a warning as its queue is bounded. Like
+ * in rmw_dds_common, SYSTEM_DEFAULT or UNKNOWN policies which might resolve to incompatible ones
+ * are a warning.
+ * \param    publisher_qos the QoS profile of the publisher
+ * \param    subscription_qos the QoS profile of the subscription
+ * \param    reason human readable description of all found problems, empty if compatible
+ * \return   RMW_QOS_COMPATIBILITY_ERROR if the entities won't communicate as requested,
+ *           RMW_QOS_COMPATIBILITY_WARNING if samples might be lost or clamped,
+ *           RMW_QOS_COMPATIBILITY_OK otherwise
+ */
+rmw_qos_compatibility_type_t
+check_qos_compatibility(
+  const rmw_qos_profile_t & publisher_qos,
+  const rmw_qos_profile_t & subscription_qos,
+  std::string & reason);
+
+}  // namespace rmw_iceoryx_cpp
+#endif  // RMW_ICEORYX_CPP__ICEORYX_QOS_HPP_
@@ -16,8 +16,14 @@
 #ifndef RMW_ICEORYX_CPP__ICEORYX_SERIALIZE_HPP_
 #define RMW_ICEORYX_CPP__ICEORYX_SERIALIZE_HPP_
 
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
+#include "rmw/error_handling.h"
+#include "rmw/types.h"
+
 struct rosidl_message_type_support_t;
 struct rosidl_service_type_support_t;
 
@@ -39,5 +45,78 @@ void serializeResponse(
   const rosidl_service_type_support_t * type_supports,
   std::vector<char> & payload_vector);
 
+/// Get the number of bytes 'serialize' writes for the given message.
+/**
+ * \param    ros_message the message to serialize
+ * \param    type_supports the introspection type support of the message
+ * \return   the exact serialized size in bytes
+ */
+size_t get_serialized_size(
+  const void * ros_message,
+  const rosidl_message_type_support_t * type_supports);
+
+size_t get_serialized_request_size(
+  const void * ros_request,
+  const rosidl_service_type_support_t * type_supports);
+
+size_t get_serialized_response_size(
+  const void * ros_response,
+  const rosidl_service_type_support_t * type_supports);
+
+/// Serialize a message in place, e.g. into a loaned chunk.
+/**
+ * \param    ros_message the message to serialize
+ * \param    type_supports the introspection type support of the message
+ * \param    buffer the memory to serialize into
+ * \param    buffer_size size of the buffer, 'get_serialized_size' tells how much is needed
+ * \throws   std::runtime_error if the buffer is too small
+ */
+void serialize(
+  const void * ros_message,
+  const rosidl_message_type_support_t * type_supports,
+  char * buffer,
+  size_t buffer_size);
+
+void serializeRequest(
+  const void * ros_request,
+  const rosidl_service_type_support_t * type_supports,
+  char * buffer,
+  size_t buffer_size);
+
+void serializeResponse(
+  const void * ros_response,
+  const rosidl_service_type_support_t * type_supports,
+  char * buffer,
+  size_t buffer_size);
+
+/// Run one of the in-place serializations for an rmw function.
+/**
+ * Exceptions must not escape through the C API, hence the error of a serialization is turned
+ * into an rmw error. A chunk loaned for the serialization would be lost as well, the caller
+ * releases it in 'release_on_error'.
+ * \param    serialize_fn the serialization to run
+ * \param    release_on_error called if the serialization failed
+ * \return   RMW_RET_OK, or RMW_RET_ERROR with the error message set if the serialization failed
+ */
+template<typename SerializeFn, typename ReleaseFn>
+rmw_ret_t try_serialize(SerializeFn && serialize_fn, ReleaseFn && release_on_error)
+{
+  try {
+    serialize_fn();
+  } catch (const std::runtime_error & error) {
+    release_on_error();
+    RMW_SET_ERROR_MSG(error.what());
+    return RMW_RET_ERROR;
+  }
+  return RMW_RET_OK;
+}
+
+/// Run an in-place serialization into memory which needs no release on error.
+template<typename SerializeFn>
+rmw_ret_t try_serialize(SerializeFn && serialize_fn)
+{
+  return try_serialize(std::forward<SerializeFn>(serialize_fn), []() {});
+}
+
 }  // namespace rmw_iceoryx_cpp
 #endif  // RMW_ICEORYX_CPP__ICEORYX_SERIALIZE_HPP_
@@ -0,0 +1,159 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_ICEORYX_CPP__ICEORYX_SERVICE_DISCOVERY_HPP_
+#define RMW_ICEORYX_CPP__ICEORYX_SERVICE_DISCOVERY_HPP_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/runtime/service_discovery.hpp"
+
+namespace rmw_iceoryx_cpp
+{
+/// @brief Hashes the three ids of a service description without allocating
+struct ServiceDescriptionHash
+{
+  size_t operator()(const iox::capro::ServiceDescription & service_description) const;
+};
+
+/// @brief Immutable view of all servers offered in the iceoryx system at one point in time
+struct ServiceDiscoverySnapshot
+{
+  std::unordered_set<iox::capro::ServiceDescription, ServiceDescriptionHash> servers_;
+  /// @brief ROS service names and their types
+  std::map<std::string, std::string> names_n_types_;
+};
+
+/// Search the service registry of RouDi once for all offered servers.
+/**
+ * \param    service_discovery the iceoryx service discovery to search with
+ * \return   the offered servers at the time of the call
+ */
+std::shared_ptr<const ServiceDiscoverySnapshot>
+find_offered_servers(iox::runtime::ServiceDiscovery & service_discovery);
+
+/// @brief Keeps the offered servers of the iceoryx system. The snapshot is rebuilt by the
+///        listener thread on every change of the service registry and swapped atomically, so
+///        readers never wait for an update. It is owned by the rmw context, hence it needs a
+///        running iceoryx runtime and is destroyed with the context.
+class ServiceDiscoveryCache
+{
+public:
+  /// @param[in] listener the listener which calls back on registry changes, it must outlive the
+  ///            cache; the context passes the one of its graph change notifier so that it has a
+  ///            single listener thread
+  explicit ServiceDiscoveryCache(iox::popo::Listener & listener);
+  ~ServiceDiscoveryCache();
+
+  ServiceDiscoveryCache(const ServiceDiscoveryCache &) = delete;
+  ServiceDiscoveryCache & operator=(const ServiceDiscoveryCache &) = delete;
+
+  /// Get the latest snapshot of the offered servers.
+  /**
+   * Querying it neither creates ports nor searches the registry.
+   * \return   the latest snapshot, it stays valid as long as the pointer is held
+   */
+  std::shared_ptr<const ServiceDiscoverySnapshot> snapshot() const;
+
+  /// Check whether a server is offered for the given service description.
+  /**
+   * \param    service_description the description of the service
+   * \return   true if the latest snapshot knows an offered server
+   */
+  bool is_server_offered(const iox::capro::ServiceDescription & service_description) const;
+
+private:
+  // must be a static method to be convertable to c function pointer
+  static void callback(iox::runtime::ServiceDiscovery *, ServiceDiscoveryCache * self);
+
+  void update();
+
+  iox::runtime::ServiceDiscovery service_discovery_;
+  /// @brief Serializes the searches, the service discovery is not thread-safe
+  std::mutex update_mutex_;
+  mutable std::mutex mutex_;
+  std::shared_ptr<const ServiceDiscoverySnapshot> snapshot_;
+  // detached in the destructor, hence no callback runs on a partially destroyed cache
+  iox::popo::Listener & listener_;
+};
+
+/// @brief Whether a service endpoint answers requests or sends them
+enum class ServiceEndpointKind : uint8_t
+{
+  SERVER,
+  CLIENT
+};
+
+/// Register a server or client of this process with the node it belongs to.
+/**
+ * The iceoryx port introspection does not cover servers and clients and the service discovery
+ * only knows offered servers without their node. The endpoints created by this process are
+ * therefore registered on creation, which attributes them to their node in graph queries. The
+ * node is identified by namespace and name joined like the iceoryx node names of its ports.
+ * \param    kind whether the endpoint is a server or a client
+ * \param    service_description the iceoryx service description of the endpoint
+ * \param    node_name the name of the node
+ * \param    node_namespace the namespace of the node, e.g. "/" or "/ns"
+ */
+void
+register_service_endpoint(
+  ServiceEndpointKind kind,
+  const iox::capro::ServiceDescription & service_description,
+  const char * node_name,
+  const char * node_namespace);
+
+/// Remove a server or client which was added by register_service_endpoint.
+/**
+ * \param    kind whether the endpoint is a server or a client
+ * \param    service_description the iceoryx service description of the endpoint
+ * \param    node_name the name of the node
+ * \param    node_namespace the namespace of the node, e.g. "/" or "/ns"
+ */
+void
+unregister_service_endpoint(
+  ServiceEndpointKind kind,
+  const iox::capro::ServiceDescription & service_description,
+  const char * node_name,
+  const char * node_namespace);
+
+/// Get the names and types of the services a node serves or is a client of.
+/**
+ * Only the endpoints of this process are known with their node, see register_service_endpoint.
+ * \param    kind whether the servers or the clients of the node are of interest
+ * \param    node_name the name of the node
+ * \param    node_namespace the namespace of the node, e.g. "/" or "/ns"
+ * \return   map of service names to their types
+ */
+std::map<std::string, std::string>
+get_service_names_and_types_of_node(
+  ServiceEndpointKind kind,
+  const char * node_name,
+  const char * node_namespace);
+
+/// Get the names and types of the services of all registered clients of this process.
+/**
+ * \return   map of service names to their types
+ */
+std::map<std::string, std::string>
+get_client_service_names_and_types();
+
+}  // namespace rmw_iceoryx_cpp
+#endif  // RMW_ICEORYX_CPP__ICEORYX_SERVICE_DISCOVERY_HPP_
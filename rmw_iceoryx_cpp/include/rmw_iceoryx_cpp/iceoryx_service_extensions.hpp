@@ -0,0 +1,162 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_ICEORYX_CPP__ICEORYX_SERVICE_EXTENSIONS_HPP_
+#define RMW_ICEORYX_CPP__ICEORYX_SERVICE_EXTENSIONS_HPP_
+
+#include <cstdint>
+
+#include "rcutils/time.h"
+
+#include "rmw/rmw.h"
+
+// Extensions of the rmw service API. The zero-copy counterparts of 'rmw_send_request',
+// 'rmw_take_request' and 'rmw_send_response' construct requests and responses right in the
+// shared memory chunk instead of copying them into it. This is only possible for fixed size
+// service types, for all other types RMW_RET_UNSUPPORTED is returned.
+
+namespace rmw_iceoryx_cpp
+{
+/// Borrow a shared memory chunk for a request and initialize the request in it.
+/**
+ * \param    client the rmw_iceoryx_cpp client which sends the request
+ * \param    ros_request set to the initialized request, it is owned by the caller until it is
+ *           passed to 'send_loaned_request' or 'return_loaned_request'
+ * \return   RMW_RET_OK if successful, RMW_RET_UNSUPPORTED if the service type is not fixed size,
+ *           RMW_RET_BAD_ALLOC if no chunk is available, RMW_RET_ERROR otherwise
+ */
+rmw_ret_t
+borrow_loaned_request(const rmw_client_t * client, void ** ros_request);
+
+/// Give back a borrowed request which was not sent.
+/**
+ * \param    client the rmw_iceoryx_cpp client which borrowed the request
+ * \param    ros_request the request obtained by 'borrow_loaned_request'
+ * \return   RMW_RET_OK if successful, RMW_RET_ERROR otherwise
+ */
+rmw_ret_t
+return_loaned_request(const rmw_client_t * client, void * ros_request);
+
+/// Send a borrowed request without copying it.
+/**
+ * \param    client the rmw_iceoryx_cpp client which borrowed the request
+ * \param    ros_request the request obtained by 'borrow_loaned_request', the loan ends with this
+ *           call whether sending succeeds or not
+ * \param    sequence_id the sequence number of the request, as with 'rmw_send_request'
+ * \return   RMW_RET_OK if successful, RMW_RET_ERROR otherwise
+ */
+rmw_ret_t
+send_loaned_request(const rmw_client_t * client, void * ros_request, int64_t * sequence_id);
+
+/// Take a request without copying it out of the shared memory chunk.
+/**
+ * \param    service the rmw_iceoryx_cpp service to take from
+ * \param    request_header filled like with 'rmw_take_request'
+ * \param    ros_request set to the request in the chunk, it stays valid until the response to it
+ *           is sent by either 'rmw_send_response' or 'send_loaned_response'; it is never
+ *           reclaimed before
+ * \param    taken true if a request was taken
+ * \return   RMW_RET_OK if successful, also if no request is taken as too many are held,
+ *           RMW_RET_UNSUPPORTED if the service type is not fixed size, RMW_RET_ERROR otherwise
+ */
+rmw_ret_t
+take_loaned_request(
+  const rmw_service_t * service,
+  rmw_service_info_t * request_header,
+  const void ** ros_request,
+  bool * taken);
+
+/// Configure how the requests a service holds without a response are reclaimed.
+/**
+ * A service holds each taken request until its response is sent, at most as many as the depth
+ * of its QoS. By default held requests are never reclaimed and no further request is taken
+ * while all places are taken. A response sent for a reclaimed request fails like one for an
+ * unknown request. Requests taken with 'take_loaned_request' are never reclaimed.
+ *
+ * \param    service the rmw_iceoryx_cpp service to configure
+ * \param    hold_timeout requests held longer than this many nanoseconds are released, 0 keeps
+ *           them until their response is sent
+ * \param    evict_oldest if true, the request held the longest is released when all places are
+ *           taken and another request is to be taken
+ * \return   RMW_RET_OK if successful, RMW_RET_INVALID_ARGUMENT or
+ *           RMW_RET_INCORRECT_RMW_IMPLEMENTATION otherwise
+ */
+rmw_ret_t
+set_held_request_reclamation(
+  const rmw_service_t * service,
+  rcutils_duration_value_t hold_timeout,
+  bool evict_oldest);
+
+/// Take up to 'count' requests in one call, e.g. to drain the queue after a single wake-up.
+/**
+ * Works for all service types, the requests are copied or deserialized like with
+ * 'rmw_take_request'. Fewer requests are taken if the queue runs empty or the service already
+ * holds as many requests as it may without a response being sent.
+ *
+ * \param    service the rmw_iceoryx_cpp service to take from
+ * \param    count the maximum number of requests to take, at most the sequence capacity
+ * \param    request_sequence initialized requests to fill, its size is set to 'taken'
+ * \param    request_headers array of at least 'count' headers, filled like with
+ *           'rmw_take_request'
+ * \param    taken the number of requests taken; these are taken even if an error is returned
+ * \return   RMW_RET_OK if successful, RMW_RET_INVALID_ARGUMENT or RMW_RET_ERROR otherwise
+ */
+rmw_ret_t
+take_request_sequence(
+  const rmw_service_t * service,
+  size_t count,
+  rmw_message_sequence_t * request_sequence,
+  rmw_service_info_t * request_headers,
+  size_t * taken);
+
+/// Borrow a shared memory chunk for the response to a taken request and initialize it.
+/**
+ * \param    service the rmw_iceoryx_cpp service which took the request
+ * \param    request_header the request id of the taken request
+ * \param    ros_response set to the initialized response, it is owned by the caller until it is
+ *           passed to 'send_loaned_response' or 'return_loaned_response'
+ * \return   RMW_RET_OK if successful, RMW_RET_UNSUPPORTED if the service type is not fixed size,
+ *           RMW_RET_BAD_ALLOC if no chunk is available, RMW_RET_ERROR otherwise
+ */
+rmw_ret_t
+borrow_loaned_response(
+  const rmw_service_t * service,
+  const rmw_request_id_t * request_header,
+  void ** ros_response);
+
+/// Give back a borrowed response which was not sent.
+/**
+ * \param    service the rmw_iceoryx_cpp service which borrowed the response
+ * \param    ros_response the response obtained by 'borrow_loaned_response'
+ * \return   RMW_RET_OK if successful, RMW_RET_ERROR otherwise
+ */
+rmw_ret_t
+return_loaned_response(const rmw_service_t * service, void * ros_response);
+
+/// Send a borrowed response without copying it and release the request it answers.
+/**
+ * \param    service the rmw_iceoryx_cpp service which borrowed the response
+ * \param    request_header the request id of the taken request
+ * \param    ros_response the response obtained by 'borrow_loaned_response', the loan ends with
+ *           this call whether sending succeeds or not
+ * \return   RMW_RET_OK if successful, RMW_RET_ERROR otherwise
+ */
+rmw_ret_t
+send_loaned_response(
+  const rmw_service_t * service,
+  const rmw_request_id_t * request_header,
+  void * ros_response);
+
+}  // namespace rmw_iceoryx_cpp
+#endif  // RMW_ICEORYX_CPP__ICEORYX_SERVICE_EXTENSIONS_HPP_
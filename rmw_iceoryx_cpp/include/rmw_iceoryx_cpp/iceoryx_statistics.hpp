@@ -0,0 +1,49 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_ICEORYX_CPP__ICEORYX_STATISTICS_HPP_
+#define RMW_ICEORYX_CPP__ICEORYX_STATISTICS_HPP_
+
+#include <cstdint>
+
+#include "rmw/rmw.h"
+
+namespace rmw_iceoryx_cpp
+{
+/// Get the number of publish calls which were skipped because no subscription was matched.
+/**
+ * \param    publisher the rmw_iceoryx_cpp publisher to query
+ * \param    count the number of skipped 'rmw_publish' calls since the publisher was created
+ * \return   RMW_RET_OK if successful, RMW_RET_INVALID_ARGUMENT or
+ *           RMW_RET_INCORRECT_RMW_IMPLEMENTATION otherwise
+ */
+rmw_ret_t
+get_skipped_publish_count(const rmw_publisher_t * publisher, uint64_t * count);
+
+/// Get the number of taken requests which were released without a response being sent.
+/**
+ * A service holds each taken request until its response is sent. Requests are only reclaimed
+ * as configured with 'set_held_request_reclamation', otherwise no request is taken while all
+ * places are taken.
+ *
+ * \param    service the rmw_iceoryx_cpp service to query
+ * \param    count the number of reclaimed requests since the service was created
+ * \return   RMW_RET_OK if successful, RMW_RET_INVALID_ARGUMENT or
+ *           RMW_RET_INCORRECT_RMW_IMPLEMENTATION otherwise
+ */
+rmw_ret_t
+get_reclaimed_request_count(const rmw_service_t * service, uint64_t * count);
+
+}  // namespace rmw_iceoryx_cpp
+#endif  // RMW_ICEORYX_CPP__ICEORYX_STATISTICS_HPP_
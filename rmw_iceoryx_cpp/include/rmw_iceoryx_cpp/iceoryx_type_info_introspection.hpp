@@ -65,5 +65,13 @@ void iceoryx_fini_message(
   const rosidl_message_type_support_t * type_supports,
   void * message);
 
+void iceoryx_init_request(
+  const rosidl_service_type_support_t * type_supports,
+  void * request);
+
+void iceoryx_init_response(
+  const rosidl_service_type_support_t * type_supports,
+  void * response);
+
 }  // namespace rmw_iceoryx_cpp
 #endif  // RMW_ICEORYX_CPP__ICEORYX_TYPE_INFO_INTROSPECTION_HPP_
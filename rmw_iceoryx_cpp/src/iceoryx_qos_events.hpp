@@ -0,0 +1,48 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ICEORYX_QOS_EVENTS_HPP_
+#define ICEORYX_QOS_EVENTS_HPP_
+
+#include <atomic>
+#include <cstdint>
+
+#include "rcutils/time.h"
+
+#include "rmw/event.h"
+#include "rmw/types.h"
+
+namespace rmw_iceoryx_cpp
+{
+/// @brief Counts the ROS-visible changes of the iceoryx graph, it is increased by the graph change
+///        notifiers and numbers the changes they publish
+std::atomic<uint64_t> & graph_generation();
+
+/// @brief QoS events are evaluated against the clock and the iceoryx graph, only the liveliness
+///        changed event is woken up by an iceoryx trigger
+/// @param[in] event the event to evaluate
+/// @param[in] now the current system time
+/// @param[out] time_until_update time after which the event has to be evaluated again
+/// @return true if the event holds a status change which can be taken
+bool update_qos_event(
+  const rmw_event_t * event,
+  rcutils_time_point_value_t now,
+  rcutils_duration_value_t & time_until_update);
+
+/// @brief Fills the status struct matching the event type and resets its change counters
+rmw_ret_t take_qos_event(const rmw_event_t * event, void * event_info, bool * taken);
+
+}  // namespace rmw_iceoryx_cpp
+
+#endif  // ICEORYX_QOS_EVENTS_HPP_
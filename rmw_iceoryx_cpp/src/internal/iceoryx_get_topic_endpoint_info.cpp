@@ -13,261 +13,172 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstring>
 #include <map>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
-#include <tuple>
-
-#include "iceoryx_posh/popo/untyped_subscriber.hpp"
-#include "iceoryx_posh/roudi/introspection_types.hpp"
 
 #include "rcutils/logging_macros.h"
-#include "rcutils/strdup.h"
 
+#include "rmw/error_handling.h"
 #include "rmw/impl/cpp/macros.hpp"
 
-#include "rmw_iceoryx_cpp/iceoryx_name_conversion.hpp"
-#include "rmw_iceoryx_cpp/iceoryx_topic_names_and_types.hpp"
+#include "rmw_iceoryx_cpp/iceoryx_graph_cache.hpp"
 #include "rmw_iceoryx_cpp/iceoryx_get_topic_endpoint_info.hpp"
 
 namespace rmw_iceoryx_cpp
 {
-std::map<std::string, std::vector<std::string>> get_publisher_and_nodes()
+namespace
+{
+/// @brief Actual QoS of the publishers of this process by the unique id of their port
+class PublisherQosRegistry
 {
-  std::map<std::string, std::string> names_n_types;
-  std::map<std::string, std::vector<std::string>> subscribers_topics;
-  std::map<std::string, std::vector<std::string>> publishers_topics;
-  std::map<std::string, std::vector<std::string>> topic_subscribers;
-  std::map<std::string, std::vector<std::string>> topic_publishers;
+public:
+  void add(uint64_t port_id, const rmw_qos_profile_t & qos)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    qos_[port_id] = qos;
+  }
+
+  void remove(uint64_t port_id)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    qos_.erase(port_id);
+  }
 
-  fill_topic_containers(
-    names_n_types, subscribers_topics, publishers_topics, topic_subscribers,
-    topic_publishers);
+  /// @return false if the publisher is not one of this process
+  bool find(uint64_t port_id, rmw_qos_profile_t & qos) const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto entry = qos_.find(port_id);
+    if (entry == qos_.end()) {
+      return false;
+    }
+    qos = entry->second;
+    return true;
+  }
 
-  return topic_publishers;
+private:
+  mutable std::mutex mutex_;
+  std::unordered_map<uint64_t, rmw_qos_profile_t> qos_;
+};
+
+PublisherQosRegistry & publisher_qos_registry()
+{
+  static PublisherQosRegistry registry;
+  return registry;
 }
 
-std::map<std::string, std::vector<std::string>> get_subscriber_and_nodes()
+/// @brief Fills one endpoint info from a record of the graph cache. The GID and the QoS are only
+///        accurate for the publishers of this process: the port introspection carries neither
+///        the id of a subscriber port nor any QoS, hence subscribers get a zero GID and the
+///        publishers of other processes get rmw_qos_profile_unknown.
+rmw_ret_t fill_endpoint_info(
+  rmw_topic_endpoint_info_t & endpoint_info,
+  const TopicEndpointRecord & record,
+  rmw_endpoint_type_t endpoint_type,
+  rcutils_allocator_t * allocator)
 {
-  std::map<std::string, std::string> names_n_types;
-  std::map<std::string, std::vector<std::string>> subscribers_topics;
-  std::map<std::string, std::vector<std::string>> publishers_topics;
-  std::map<std::string, std::vector<std::string>> topic_subscribers;
-  std::map<std::string, std::vector<std::string>> topic_publishers;
+  // the setters copy the strings
+  rmw_ret_t rmw_ret = rmw_topic_endpoint_info_set_topic_type(
+    &endpoint_info, record.type_name_->c_str(), allocator);
+  if (rmw_ret != RMW_RET_OK) {
+    return rmw_ret;
+  }
+  rmw_ret = rmw_topic_endpoint_info_set_node_name(
+    &endpoint_info, record.node_name_.c_str(), allocator);
+  if (rmw_ret != RMW_RET_OK) {
+    return rmw_ret;
+  }
+  rmw_ret = rmw_topic_endpoint_info_set_node_namespace(
+    &endpoint_info, record.node_namespace_.c_str(), allocator);
+  if (rmw_ret != RMW_RET_OK) {
+    return rmw_ret;
+  }
+  rmw_ret = rmw_topic_endpoint_info_set_endpoint_type(&endpoint_info, endpoint_type);
+  if (rmw_ret != RMW_RET_OK) {
+    return rmw_ret;
+  }
 
-  fill_topic_containers(
-    names_n_types, subscribers_topics, publishers_topics, topic_subscribers,
-    topic_publishers);
+  // same layout as the GID of a publisher of this process, see generate_publisher_gid
+  uint8_t gid[RMW_GID_STORAGE_SIZE] = {};
+  static_assert(sizeof(record.port_id_) <= RMW_GID_STORAGE_SIZE, "port id exceeds the GID");
+  memcpy(gid, &record.port_id_, sizeof(record.port_id_));
+  rmw_ret = rmw_topic_endpoint_info_set_gid(&endpoint_info, gid, RMW_GID_STORAGE_SIZE);
+  if (rmw_ret != RMW_RET_OK) {
+    return rmw_ret;
+  }
 
-  return topic_subscribers;
+  rmw_qos_profile_t qos = record.qos_;
+  if (endpoint_type == RMW_ENDPOINT_PUBLISHER && record.port_id_ != 0U) {
+    publisher_qos_registry().find(record.port_id_, qos);
+  }
+  return rmw_topic_endpoint_info_set_qos_profile(&endpoint_info, &qos);
 }
+}  // namespace
 
-std::tuple<std::string, std::vector<std::string>> get_publisher_end_info_of_topic(
-  const char * topic_name)
+std::map<std::string, std::vector<std::string>> get_publisher_and_nodes()
 {
-  std::map<std::string, std::string> names_n_types;
-  std::map<std::string, std::vector<std::string>> subscribers_topics;
-  std::map<std::string, std::vector<std::string>> publishers_topics;
-  std::map<std::string, std::vector<std::string>> topic_subscribers;
-  std::map<std::string, std::vector<std::string>> topic_publishers;
+  return get_graph_snapshot()->topic_publishers_;
+}
 
-  fill_topic_containers(
-    names_n_types, subscribers_topics, publishers_topics, topic_subscribers,
-    topic_publishers);
-  auto full_name_array = topic_publishers[std::string(topic_name)];
-  auto topic_type = names_n_types[topic_name];
-  return std::make_tuple(topic_type, full_name_array);
+std::map<std::string, std::vector<std::string>> get_subscriber_and_nodes()
+{
+  return get_graph_snapshot()->topic_subscribers_;
 }
 
-std::tuple<std::string, std::vector<std::string>> get_subscriber_end_info_of_topic(
-  const char * topic_name)
+void register_publisher_qos(uint64_t port_id, const rmw_qos_profile_t & qos)
 {
-  std::map<std::string, std::string> names_n_types;
-  std::map<std::string, std::vector<std::string>> subscribers_topics;
-  std::map<std::string, std::vector<std::string>> publishers_topics;
-  std::map<std::string, std::vector<std::string>> topic_subscribers;
-  std::map<std::string, std::vector<std::string>> topic_publishers;
+  publisher_qos_registry().add(port_id, qos);
+}
 
-  fill_topic_containers(
-    names_n_types, subscribers_topics, publishers_topics, topic_subscribers,
-    topic_publishers);
-  auto full_name_array = topic_subscribers[std::string(topic_name)];
-  auto topic_type = names_n_types[topic_name];
-  return std::make_tuple(topic_type, full_name_array);
+void unregister_publisher_qos(uint64_t port_id)
+{
+  publisher_qos_registry().remove(port_id);
 }
 
 rmw_ret_t
-fill_rmw_publisher_end_info(
+fill_rmw_topic_endpoint_info(
   rmw_topic_endpoint_info_array_t * rmw_topic_endpoint_info_array,
-  const std::tuple<std::string, std::vector<std::string>> & iceoryx_topic_endpoint_info,
+  const char * topic_name,
+  rmw_endpoint_type_t endpoint_type,
   rcutils_allocator_t * allocator)
 {
-  rmw_ret_t rmw_ret = RMW_RET_ERROR;
-
-  auto topic_type = std::get<0>(iceoryx_topic_endpoint_info);
-  auto full_name_array = std::get<1>(iceoryx_topic_endpoint_info);
-
-  if (!full_name_array.empty()) {
-    rmw_ret = rmw_topic_endpoint_info_array_init_with_size(
-      rmw_topic_endpoint_info_array, full_name_array.size(),
-      allocator);
-    if (rmw_ret != RMW_RET_OK) {
-      return rmw_ret;
-    }
-  }
-
-  int i = 0;
-  // store all data in rmw_topic_endpoint_info_array_t
-  for (const auto & node_full_name : full_name_array) {
-    auto name_n_space = get_name_n_space_from_node_full_name(node_full_name);
-    auto rmw_topic_endpoint_info = rmw_get_zero_initialized_topic_endpoint_info();
-    // duplicate and store the topic_name
-    char * topic_type_cstr = rcutils_strdup(topic_type.c_str(), *allocator);
-    if (!topic_type_cstr) {
-      RMW_SET_ERROR_MSG("failed to allocate memory for topic_type");
-      goto fail;
-    }
-    rmw_ret = rmw_topic_endpoint_info_set_topic_type(
-      &rmw_topic_endpoint_info, topic_type_cstr,
-      allocator);
-    if (rmw_ret != RMW_RET_OK) {
-      RCUTILS_LOG_ERROR("error during report of error: %s", rmw_get_error_string().str);
-      goto fail;
-    }
-
-    char * node_name = rcutils_strdup(std::get<0>(name_n_space).c_str(), *allocator);
-    if (!node_name) {
-      RMW_SET_ERROR_MSG("failed to allocate memory for node_name");
-      goto fail;
-    }
-    rmw_ret = rmw_topic_endpoint_info_set_node_name(&rmw_topic_endpoint_info, node_name, allocator);
-    if (rmw_ret != RMW_RET_OK) {
-      RCUTILS_LOG_ERROR("error during report of error: %s", rmw_get_error_string().str);
-      goto fail;
-    }
-
-    char * node_namespace = rcutils_strdup(std::get<1>(name_n_space).c_str(), *allocator);
-    if (!node_namespace) {
-      RMW_SET_ERROR_MSG("failed to allocate memory for node_namespace");
-      goto fail;
-    }
-    rmw_ret = rmw_topic_endpoint_info_set_node_namespace(
-      &rmw_topic_endpoint_info, node_namespace,
-      allocator);
-    if (rmw_ret != RMW_RET_OK) {
-      RCUTILS_LOG_ERROR("error during report of error: %s", rmw_get_error_string().str);
-      goto fail;
-    }
-
-    rmw_ret = rmw_topic_endpoint_info_set_endpoint_type(
-      &rmw_topic_endpoint_info,
-      RMW_ENDPOINT_PUBLISHER);
-    if (rmw_ret != RMW_RET_OK) {
-      RCUTILS_LOG_ERROR("error during report of error: %s", rmw_get_error_string().str);
-      goto fail;
-    }
-    /// @todo support gid and qos setting
-
-    // set array
-    rmw_topic_endpoint_info_array->info_array[i] = rmw_topic_endpoint_info;
-    i++;
+  // the snapshot is held until the records are copied out, they are not copied beforehand
+  auto graph = get_graph_snapshot();
+  const auto & topic_records = (endpoint_type == RMW_ENDPOINT_PUBLISHER) ?
+    graph->topic_publisher_records_ : graph->topic_subscriber_records_;
+
+  auto records = topic_records.find(topic_name);
+  if (records == topic_records.end() || records->second.empty()) {
+    return RMW_RET_OK;
   }
 
-  return RMW_RET_OK;
-
-fail:
-  rmw_ret = rmw_topic_endpoint_info_array_fini(rmw_topic_endpoint_info_array, allocator);
+  rmw_ret_t rmw_ret = rmw_topic_endpoint_info_array_init_with_size(
+    rmw_topic_endpoint_info_array, records->second.size(), allocator);
   if (rmw_ret != RMW_RET_OK) {
-    RCUTILS_LOG_ERROR("error during report of error: %s", rmw_get_error_string().str);
+    return rmw_ret;
   }
-  return RMW_RET_ERROR;
-}
-
-rmw_ret_t
-fill_rmw_subscriber_end_info(
-  rmw_topic_endpoint_info_array_t * rmw_topic_endpoint_info_array,
-  const std::tuple<std::string, std::vector<std::string>> & iceoryx_topic_endpoint_info,
-  rcutils_allocator_t * allocator)
-{
-  rmw_ret_t rmw_ret = RMW_RET_ERROR;
-
-  auto topic_type = std::get<0>(iceoryx_topic_endpoint_info);
-  auto full_name_array = std::get<1>(iceoryx_topic_endpoint_info);
 
-  if (!full_name_array.empty()) {
-    rmw_ret = rmw_topic_endpoint_info_array_init_with_size(
-      rmw_topic_endpoint_info_array, full_name_array.size(),
-      allocator);
+  size_t i = 0U;
+  for (const auto & record : records->second) {
+    auto & endpoint_info = rmw_topic_endpoint_info_array->info_array[i];
+    endpoint_info = rmw_get_zero_initialized_topic_endpoint_info();
+    rmw_ret = fill_endpoint_info(endpoint_info, record, endpoint_type, allocator);
     if (rmw_ret != RMW_RET_OK) {
+      if (RMW_RET_OK != rmw_topic_endpoint_info_array_fini(
+          rmw_topic_endpoint_info_array, allocator))
+      {
+        RCUTILS_LOG_ERROR("error during report of error: %s", rmw_get_error_string().str);
+      }
       return rmw_ret;
     }
-  }
-
-  int i = 0;
-  // store all data in rmw_topic_endpoint_info_array_t
-  for (const auto & node_full_name : full_name_array) {
-    auto name_n_space = get_name_n_space_from_node_full_name(node_full_name);
-    auto rmw_topic_endpoint_info = rmw_get_zero_initialized_topic_endpoint_info();
-    // duplicate and store the topic_name
-    char * topic_type_cstr = rcutils_strdup(topic_type.c_str(), *allocator);
-    if (!topic_type_cstr) {
-      RMW_SET_ERROR_MSG("failed to allocate memory for topic_type");
-      goto fail;
-    }
-    rmw_ret = rmw_topic_endpoint_info_set_topic_type(
-      &rmw_topic_endpoint_info, topic_type_cstr,
-      allocator);
-    if (rmw_ret != RMW_RET_OK) {
-      RCUTILS_LOG_ERROR("error during report of error: %s", rmw_get_error_string().str);
-      goto fail;
-    }
-
-    char * node_name = rcutils_strdup(std::get<0>(name_n_space).c_str(), *allocator);
-    if (!node_name) {
-      RMW_SET_ERROR_MSG("failed to allocate memory for node_name");
-      goto fail;
-    }
-    rmw_ret = rmw_topic_endpoint_info_set_node_name(&rmw_topic_endpoint_info, node_name, allocator);
-    if (rmw_ret != RMW_RET_OK) {
-      RCUTILS_LOG_ERROR("error during report of error: %s", rmw_get_error_string().str);
-      goto fail;
-    }
-
-    char * node_namespace = rcutils_strdup(std::get<1>(name_n_space).c_str(), *allocator);
-    if (!node_namespace) {
-      RMW_SET_ERROR_MSG("failed to allocate memory for node_namespace");
-      goto fail;
-    }
-    rmw_ret = rmw_topic_endpoint_info_set_node_namespace(
-      &rmw_topic_endpoint_info, node_namespace,
-      allocator);
-    if (rmw_ret != RMW_RET_OK) {
-      RCUTILS_LOG_ERROR("error during report of error: %s", rmw_get_error_string().str);
-      goto fail;
-    }
-
-    rmw_ret = rmw_topic_endpoint_info_set_endpoint_type(
-      &rmw_topic_endpoint_info,
-      RMW_ENDPOINT_SUBSCRIPTION);
-    if (rmw_ret != RMW_RET_OK) {
-      RCUTILS_LOG_ERROR("error during report of error: %s", rmw_get_error_string().str);
-      goto fail;
-    }
-    /// @todo support gid and qos setting
-
-    // set array
-    rmw_topic_endpoint_info_array->info_array[i] = rmw_topic_endpoint_info;
-    i++;
+    ++i;
   }
 
   return RMW_RET_OK;
-
-fail:
-  rmw_ret = rmw_topic_endpoint_info_array_fini(rmw_topic_endpoint_info_array, allocator);
-  if (rmw_ret != RMW_RET_OK) {
-    RCUTILS_LOG_ERROR("error during report of error: %s", rmw_get_error_string().str);
-  }
-  return RMW_RET_ERROR;
 }
 
 }  // namespace rmw_iceoryx_cpp
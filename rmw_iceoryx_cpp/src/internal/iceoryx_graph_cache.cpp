@@ -0,0 +1,272 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+
+#include "rmw/error_handling.h"
+
+#include "rmw_iceoryx_cpp/iceoryx_graph_cache.hpp"
+#include "rmw_iceoryx_cpp/iceoryx_name_conversion.hpp"
+
+namespace rmw_iceoryx_cpp
+{
+namespace
+{
+/// @brief Owns the subscriber to a RouDi introspection topic and the latest snapshot built from
+///        it. Readers load the snapshot atomically and never wait; whoever notices a new sample
+///        first builds the next snapshot while the others keep using the current one.
+template<typename SampleT, typename SnapshotT>
+class IntrospectionCache
+{
+public:
+  using BuildSnapshot = SnapshotT (*)(const SampleT &);
+
+  IntrospectionCache(const iox::capro::ServiceDescription & service, BuildSnapshot build_snapshot)
+  : receiver_(service, iox::popo::SubscriberOptions{1U, 1U, "", true}),
+    build_snapshot_(build_snapshot),
+    snapshot_(std::make_shared<const SnapshotT>())
+  {
+    receiver_.subscribe();
+    // wait for delivery on subscribe, without a sample the snapshot stays empty until the next
+    wait_for_introspection_sample(receiver_);
+    update();
+  }
+
+  std::shared_ptr<const SnapshotT> snapshot()
+  {
+    std::unique_lock<std::mutex> lock(update_mutex_, std::try_to_lock);
+    if (lock.owns_lock()) {
+      update();
+    }
+    return std::atomic_load(&snapshot_);
+  }
+
+private:
+  /// @brief Builds a new snapshot if a new introspection sample arrived, only the latest sample
+  ///        is of interest
+  void update()
+  {
+    const void * latest_user_payload = nullptr;
+
+    while (receiver_.take()
+      .and_then(
+        [&](const void * userPayload) {
+          if (latest_user_payload) {
+            receiver_.release(latest_user_payload);
+          }
+          latest_user_payload = userPayload;
+        })
+      .or_else(
+        [](auto & result) {
+          if (result != iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE) {
+            RMW_SET_ERROR_MSG("failed to take message");
+          }
+        }))
+    {
+    }
+
+    if (!latest_user_payload) {
+      return;
+    }
+
+    auto snapshot = std::make_shared<SnapshotT>(
+      build_snapshot_(*static_cast<const SampleT *>(latest_user_payload)));
+    receiver_.release(latest_user_payload);
+
+    snapshot->generation_ = ++generation_;
+    std::atomic_store(&snapshot_, std::shared_ptr<const SnapshotT>(std::move(snapshot)));
+  }
+
+  iox::popo::UntypedSubscriber receiver_;
+  const BuildSnapshot build_snapshot_;
+  std::mutex update_mutex_;
+  uint64_t generation_{0U};
+  std::shared_ptr<const SnapshotT> snapshot_;
+};
+
+TopicEndpointRecord make_endpoint_record(
+  const std::shared_ptr<const InternedNameNType> & name_n_type,
+  const std::string & node_full_name,
+  uint64_t port_id)
+{
+  TopicEndpointRecord record;
+  std::tie(record.node_name_, record.node_namespace_) =
+    get_name_n_space_from_node_full_name(node_full_name);
+  // shares the ownership of the interned entry, which keeps it from being swept
+  record.type_name_ = std::shared_ptr<const std::string>(name_n_type, &name_n_type->type_);
+  record.port_id_ = port_id;
+  return record;
+}
+}  // namespace
+
+bool
+wait_for_introspection_sample(
+  iox::popo::UntypedSubscriber & subscriber,
+  std::chrono::milliseconds timeout)
+{
+  if (subscriber.hasData()) {
+    return true;
+  }
+
+  iox::popo::WaitSet<1U> waitset;
+  if (waitset.attachState(subscriber, iox::popo::SubscriberState::HAS_DATA).has_error()) {
+    RMW_SET_ERROR_MSG("failed to attach introspection subscriber to WaitSet");
+    return false;
+  }
+  waitset.timedWait(iox::units::Duration::fromMilliseconds(timeout.count()));
+  return subscriber.hasData();
+}
+
+GraphSnapshot
+build_graph_snapshot(const iox::roudi::PortIntrospectionFieldTopic & port_sample)
+{
+  GraphSnapshot snapshot;
+
+  for (auto & receiver : port_sample.m_subscriberList) {
+    auto name_n_type = get_interned_name_n_type(
+      receiver.m_caproServiceID, receiver.m_caproInstanceID, receiver.m_caproEventMethodID);
+    std::string node(receiver.m_node.c_str());
+
+    ++snapshot.topic_endpoint_counts_[name_n_type->name_].subscribers_;
+    snapshot.topic_subscriber_records_[name_n_type->name_].push_back(
+      make_endpoint_record(name_n_type, node, 0U));
+    snapshot.subscribers_topics_[node].push_back(name_n_type->name_);
+    snapshot.topic_subscribers_[name_n_type->name_].push_back(std::move(node));
+    snapshot.names_n_types_[name_n_type->name_] = name_n_type->type_;
+  }
+  for (auto & sender : port_sample.m_publisherList) {
+    auto name_n_type = get_interned_name_n_type(
+      sender.m_caproServiceID, sender.m_caproInstanceID, sender.m_caproEventMethodID);
+    std::string node(sender.m_node.c_str());
+
+    ++snapshot.topic_endpoint_counts_[name_n_type->name_].publishers_;
+    snapshot.topic_publisher_records_[name_n_type->name_].push_back(
+      make_endpoint_record(name_n_type, node, sender.m_publisherPortID));
+    snapshot.publishers_topics_[node].push_back(name_n_type->name_);
+    snapshot.topic_publishers_[name_n_type->name_].push_back(std::move(node));
+    snapshot.names_n_types_[name_n_type->name_] = name_n_type->type_;
+  }
+
+  return snapshot;
+}
+
+std::vector<GraphEndpoint>
+collect_graph_endpoints(const iox::roudi::PortIntrospectionFieldTopic & port_sample)
+{
+  std::vector<GraphEndpoint> endpoints;
+  endpoints.reserve(port_sample.m_publisherList.size() + port_sample.m_subscriberList.size());
+
+  auto add_endpoint = [&endpoints](GraphEndpoint::Kind kind, const auto & port) {
+      auto name_n_type = get_interned_name_n_type(
+        port.m_caproServiceID, port.m_caproInstanceID, port.m_caproEventMethodID);
+      GraphEndpoint endpoint;
+      endpoint.kind_ = kind;
+      endpoint.topic_name_ = name_n_type->name_;
+      endpoint.type_name_ = name_n_type->type_;
+      endpoint.node_name_ = port.m_node.c_str();
+      endpoints.push_back(std::move(endpoint));
+    };
+
+  for (auto & sender : port_sample.m_publisherList) {
+    add_endpoint(GraphEndpoint::Kind::PUBLISHER, sender);
+  }
+  for (auto & receiver : port_sample.m_subscriberList) {
+    add_endpoint(GraphEndpoint::Kind::SUBSCRIBER, receiver);
+  }
+
+  std::sort(endpoints.begin(), endpoints.end());
+  return endpoints;
+}
+
+GraphChange
+diff_graph_endpoints(
+  const std::vector<GraphEndpoint> & previous,
+  const std::vector<GraphEndpoint> & current)
+{
+  GraphChange change;
+  std::set_difference(
+    current.begin(), current.end(), previous.begin(), previous.end(),
+    std::back_inserter(change.added_));
+  std::set_difference(
+    previous.begin(), previous.end(), current.begin(), current.end(),
+    std::back_inserter(change.removed_));
+  return change;
+}
+
+std::unordered_map<std::string, size_t>
+count_graph_publishers(const std::vector<GraphEndpoint> & endpoints)
+{
+  std::unordered_map<std::string, size_t> topic_publisher_counts;
+  for (auto & endpoint : endpoints) {
+    if (endpoint.kind_ == GraphEndpoint::Kind::PUBLISHER) {
+      ++topic_publisher_counts[endpoint.topic_name_];
+    }
+  }
+  return topic_publisher_counts;
+}
+
+std::shared_ptr<const GraphSnapshot>
+get_graph_snapshot()
+{
+  static IntrospectionCache<iox::roudi::PortIntrospectionFieldTopic, GraphSnapshot> graph_cache(
+    iox::roudi::IntrospectionPortService, build_graph_snapshot);
+  return graph_cache.snapshot();
+}
+
+NodeNamesSnapshot
+build_node_names_snapshot(const iox::roudi::ProcessIntrospectionFieldTopic & process_sample)
+{
+  // sorted and free of duplicates like the full names
+  std::set<std::string> full_names;
+  for (auto & process : process_sample.m_processList) {
+    for (auto & node : process.m_nodes) {
+      full_names.insert(std::string(node.c_str()));
+    }
+  }
+
+  NodeNamesSnapshot snapshot;
+  snapshot.node_names_.reserve(full_names.size());
+  snapshot.node_namespaces_.reserve(full_names.size());
+  for (auto & full_name : full_names) {
+    std::string node_name;
+    std::string node_namespace;
+    std::tie(node_name, node_namespace) = get_name_n_space_from_node_full_name(full_name);
+    snapshot.node_names_.push_back(std::move(node_name));
+    snapshot.node_namespaces_.push_back(std::move(node_namespace));
+  }
+  return snapshot;
+}
+
+std::shared_ptr<const NodeNamesSnapshot>
+get_node_names_snapshot()
+{
+  static IntrospectionCache<iox::roudi::ProcessIntrospectionFieldTopic, NodeNamesSnapshot>
+  node_names_cache(iox::roudi::IntrospectionProcessService, build_node_names_snapshot);
+  return node_names_cache.snapshot();
+}
+
+}  // namespace rmw_iceoryx_cpp
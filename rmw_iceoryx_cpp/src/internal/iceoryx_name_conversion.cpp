@@ -14,10 +14,17 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <regex>
 #include <string>
 #include <tuple>
+#include <unordered_map>
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
 
 #include "rcpputils/split.hpp"
 
@@ -35,6 +42,7 @@
 #include "rmw/error_handling.h"
 
 #include "rmw_iceoryx_cpp/iceoryx_name_conversion.hpp"
+#include "rmw_iceoryx_cpp/iceoryx_service_discovery.hpp"
 #include "rmw_iceoryx_cpp/iceoryx_type_info_introspection.hpp"
 
 static constexpr char ARA_DELIMITER[] = "_ara_msgs/msg/";
@@ -122,6 +130,47 @@ get_name_n_type_from_service_description(
     service_lowercase + ARA_DELIMITER + event);
 }
 
+std::shared_ptr<const InternedNameNType>
+get_interned_name_n_type(
+  const iox::capro::IdString_t & service,
+  const iox::capro::IdString_t & instance,
+  const iox::capro::IdString_t & event)
+{
+  // Every port RouDi holds at a time has one service description, hence up to this many entries
+  // are in use at once. Growth beyond it only comes from names which are no longer in use, they
+  // are swept once the bound is exceeded. Entries still held by a graph snapshot stay, so the
+  // sweep is repeated only after the map doubled in size to keep its cost amortized.
+  constexpr size_t MAX_INTERNED =
+    iox::MAX_PUBLISHERS + iox::MAX_SUBSCRIBERS + iox::MAX_SERVERS + iox::MAX_CLIENTS;
+
+  // the service description is only used as key, it holds the ids without allocating
+  static std::mutex mutex;
+  static std::unordered_map<iox::capro::ServiceDescription,
+    std::shared_ptr<const InternedNameNType>, ServiceDescriptionHash> interned;
+  static size_t sweep_size = MAX_INTERNED;
+
+  iox::capro::ServiceDescription key(service, instance, event);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto entry = interned.find(key);
+  if (entry != interned.end()) {
+    return entry->second;
+  }
+
+  if (interned.size() >= sweep_size) {
+    // new handles are only handed out under the lock, an entry held by the map alone is unused
+    for (auto it = interned.begin(); it != interned.end(); ) {
+      it = (it->second.use_count() == 1) ? interned.erase(it) : std::next(it);
+    }
+    sweep_size = std::max(MAX_INTERNED, 2U * interned.size());
+  }
+
+  auto name_n_type = std::make_shared<InternedNameNType>();
+  std::tie(name_n_type->name_, name_n_type->type_) = get_name_n_type_from_service_description(
+    std::string(service.c_str()), std::string(instance.c_str()), std::string(event.c_str()));
+  return interned.emplace(std::move(key), std::move(name_n_type)).first->second;
+}
+
 std::tuple<std::string, std::string, std::string>
 get_service_description_from_name_n_type(
   const std::string & topic_name,
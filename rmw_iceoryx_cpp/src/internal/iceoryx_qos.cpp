@@ -0,0 +1,252 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include "rmw_iceoryx_cpp/iceoryx_qos.hpp"
+
+#include "../types/iceoryx_deadline.hpp"
+
+namespace rmw_iceoryx_cpp
+{
+namespace
+{
+/// @brief Only RELIABLE together with KEEP_ALL asks for a lossless delivery
+bool is_blocking(const rmw_qos_profile_t & qos_policies)
+{
+  return RMW_QOS_POLICY_RELIABILITY_RELIABLE == qos_policies.reliability &&
+         RMW_QOS_POLICY_HISTORY_KEEP_ALL == qos_policies.history;
+}
+
+/// @brief Number of samples the profile asks to keep, bounded by the capacity iceoryx supports
+uint64_t requested_depth(const rmw_qos_profile_t & qos_policies, uint64_t capacity)
+{
+  if (RMW_QOS_POLICY_HISTORY_KEEP_ALL == qos_policies.history) {
+    return capacity;
+  }
+  return std::max<uint64_t>(1U, std::min<uint64_t>(qos_policies.depth, capacity));
+}
+
+uint64_t publisher_history_capacity(const rmw_qos_profile_t & qos_policies)
+{
+  if (RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL != qos_policies.durability) {
+    return 0U;
+  }
+  return requested_depth(qos_policies, iox::MAX_PUBLISHER_HISTORY);
+}
+
+bool is_unresolved(rmw_qos_reliability_policy_t reliability)
+{
+  return RMW_QOS_POLICY_RELIABILITY_SYSTEM_DEFAULT == reliability ||
+         RMW_QOS_POLICY_RELIABILITY_UNKNOWN == reliability;
+}
+
+bool is_unresolved(rmw_qos_durability_policy_t durability)
+{
+  return RMW_QOS_POLICY_DURABILITY_SYSTEM_DEFAULT == durability ||
+         RMW_QOS_POLICY_DURABILITY_UNKNOWN == durability;
+}
+
+bool is_unresolved(rmw_qos_liveliness_policy_t liveliness)
+{
+  return RMW_QOS_POLICY_LIVELINESS_SYSTEM_DEFAULT == liveliness ||
+         RMW_QOS_POLICY_LIVELINESS_UNKNOWN == liveliness;
+}
+
+/// @brief True if the offered period fulfills the requested one, 0 stands for infinite
+bool is_period_fulfilled(const rmw_time_t & offered_period, const rmw_time_t & requested_period)
+{
+  auto offered = iceoryx_qos_duration_to_nsec(offered_period);
+  auto requested = iceoryx_qos_duration_to_nsec(requested_period);
+  return requested == 0 || (offered != 0 && offered <= requested);
+}
+}  // namespace
+
+iox::popo::PublisherOptions
+get_iceoryx_publisher_options(
+  const rmw_qos_profile_t & qos_policies,
+  const std::string & node_full_name)
+{
+  iox::popo::PublisherOptions options;
+  options.historyCapacity = publisher_history_capacity(qos_policies);
+  options.nodeName = iox::NodeName_t(iox::cxx::TruncateToCapacity, node_full_name);
+  options.subscriberTooSlowPolicy = is_blocking(qos_policies) ?
+    iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER :
+    iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA;
+  return options;
+}
+
+iox::popo::SubscriberOptions
+get_iceoryx_subscriber_options(
+  const rmw_qos_profile_t & qos_policies,
+  const std::string & node_full_name)
+{
+  iox::popo::SubscriberOptions options;
+  options.queueCapacity = requested_depth(qos_policies, iox::MAX_SUBSCRIBER_QUEUE_CAPACITY);
+  options.nodeName = iox::NodeName_t(iox::cxx::TruncateToCapacity, node_full_name);
+  // a blocking subscriber is not connected to discarding publishers, e.g. ones with the default
+  // profile, hence only the publisher side of RELIABLE KEEP_ALL waits for its consumers
+  options.queueFullPolicy = iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA;
+  if (RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL == qos_policies.durability) {
+    options.historyRequest = requested_depth(qos_policies, iox::MAX_PUBLISHER_HISTORY);
+    options.requiresPublisherHistorySupport = true;
+  }
+  return options;
+}
+
+rmw_qos_compatibility_type_t
+check_qos_compatibility(
+  const rmw_qos_profile_t & publisher_qos,
+  const rmw_qos_profile_t & subscription_qos,
+  std::string & reason)
+{
+  rmw_qos_compatibility_type_t compatibility = RMW_QOS_COMPATIBILITY_OK;
+  reason.clear();
+
+  auto append_reason = [&](const std::string & text) {
+      if (!reason.empty()) {
+        reason += "; ";
+      }
+      reason += text;
+    };
+  auto error = [&](const std::string & text) {
+      compatibility = RMW_QOS_COMPATIBILITY_ERROR;
+      append_reason("ERROR: " + text);
+    };
+  auto warning = [&](const std::string & text) {
+      if (RMW_QOS_COMPATIBILITY_OK == compatibility) {
+        compatibility = RMW_QOS_COMPATIBILITY_WARNING;
+      }
+      append_reason("WARNING: " + text);
+    };
+
+  // reliability
+  if (RMW_QOS_POLICY_RELIABILITY_BEST_EFFORT == publisher_qos.reliability &&
+    RMW_QOS_POLICY_RELIABILITY_RELIABLE == subscription_qos.reliability)
+  {
+    error("Best effort publisher and reliable subscription");
+  }
+
+  // keep all vs. the bounded queue, iceoryx subscribers never block their publishers
+  if (RMW_QOS_POLICY_HISTORY_KEEP_ALL == subscription_qos.history) {
+    warning(
+      "Keep all subscription, samples are lost when its queue of " +
+      std::to_string(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY) + " samples is full");
+  }
+
+  // durability vs. history capacity
+  if (RMW_QOS_POLICY_DURABILITY_VOLATILE == publisher_qos.durability &&
+    RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL == subscription_qos.durability)
+  {
+    error(
+      "Volatile publisher and transient local subscription, the subscription requires a "
+      "publisher history");
+  } else if (RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL == publisher_qos.durability &&
+    RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL == subscription_qos.durability)
+  {
+    auto offered = publisher_history_capacity(publisher_qos);
+    auto requested = requested_depth(subscription_qos, iox::MAX_PUBLISHER_HISTORY);
+    if (offered < requested) {
+      warning(
+        "Subscription requests " + std::to_string(requested) +
+        " historical samples, but the publisher keeps only " + std::to_string(offered));
+    }
+  }
+
+  // depth vs. capacity limits of iceoryx
+  if (RMW_QOS_POLICY_HISTORY_KEEP_LAST == subscription_qos.history &&
+    subscription_qos.depth > iox::MAX_SUBSCRIBER_QUEUE_CAPACITY)
+  {
+    warning(
+      "Subscription depth " + std::to_string(subscription_qos.depth) +
+      " exceeds the maximum queue capacity of " +
+      std::to_string(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY));
+  }
+  if (RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL == publisher_qos.durability &&
+    RMW_QOS_POLICY_HISTORY_KEEP_LAST == publisher_qos.history &&
+    publisher_qos.depth > iox::MAX_PUBLISHER_HISTORY)
+  {
+    warning(
+      "Publisher depth " + std::to_string(publisher_qos.depth) +
+      " exceeds the maximum history capacity of " + std::to_string(iox::MAX_PUBLISHER_HISTORY));
+  }
+
+  // deadline
+  if (!is_period_fulfilled(publisher_qos.deadline, subscription_qos.deadline))
+  {
+    error("Subscription deadline is shorter than the publisher deadline");
+  }
+
+  // liveliness
+  if (RMW_QOS_POLICY_LIVELINESS_AUTOMATIC == publisher_qos.liveliness &&
+    RMW_QOS_POLICY_LIVELINESS_MANUAL_BY_TOPIC == subscription_qos.liveliness)
+  {
+    error("Automatic liveliness publisher and manual by topic liveliness subscription");
+  }
+  if (!is_period_fulfilled(
+      publisher_qos.liveliness_lease_duration, subscription_qos.liveliness_lease_duration))
+  {
+    error("Subscription liveliness lease duration is shorter than the publisher one");
+  }
+
+  // like rmw_dds_common, SYSTEM_DEFAULT and UNKNOWN policies might resolve to incompatible ones,
+  // which is only worth a warning if nothing else is incompatible
+  if (RMW_QOS_COMPATIBILITY_ERROR != compatibility) {
+    if (is_unresolved(publisher_qos.reliability) && is_unresolved(subscription_qos.reliability)) {
+      warning("Publisher and subscription reliability are SYSTEM_DEFAULT or UNKNOWN");
+    } else if (is_unresolved(publisher_qos.reliability) &&
+      RMW_QOS_POLICY_RELIABILITY_RELIABLE == subscription_qos.reliability)
+    {
+      warning("Publisher reliability is SYSTEM_DEFAULT or UNKNOWN and subscription is reliable");
+    } else if (RMW_QOS_POLICY_RELIABILITY_BEST_EFFORT == publisher_qos.reliability &&
+      is_unresolved(subscription_qos.reliability))
+    {
+      warning("Publisher is best effort and subscription reliability is SYSTEM_DEFAULT or UNKNOWN");
+    }
+
+    if (is_unresolved(publisher_qos.durability) && is_unresolved(subscription_qos.durability)) {
+      warning("Publisher and subscription durability are SYSTEM_DEFAULT or UNKNOWN");
+    } else if (is_unresolved(publisher_qos.durability) &&
+      RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL == subscription_qos.durability)
+    {
+      warning(
+        "Publisher durability is SYSTEM_DEFAULT or UNKNOWN and subscription is transient local");
+    } else if (RMW_QOS_POLICY_DURABILITY_VOLATILE == publisher_qos.durability &&
+      is_unresolved(subscription_qos.durability))
+    {
+      warning("Publisher is volatile and subscription durability is SYSTEM_DEFAULT or UNKNOWN");
+    }
+
+    if (is_unresolved(publisher_qos.liveliness) && is_unresolved(subscription_qos.liveliness)) {
+      warning("Publisher and subscription liveliness are SYSTEM_DEFAULT or UNKNOWN");
+    } else if (is_unresolved(publisher_qos.liveliness) &&
+      RMW_QOS_POLICY_LIVELINESS_MANUAL_BY_TOPIC == subscription_qos.liveliness)
+    {
+      warning(
+        "Publisher liveliness is SYSTEM_DEFAULT or UNKNOWN and subscription is manual by topic");
+    } else if (RMW_QOS_POLICY_LIVELINESS_AUTOMATIC == publisher_qos.liveliness &&
+      is_unresolved(subscription_qos.liveliness))
+    {
+      warning("Publisher is automatic and subscription liveliness is SYSTEM_DEFAULT or UNKNOWN");
+    }
+  }
+
+  return compatibility;
+}
+
+}  // namespace rmw_iceoryx_cpp
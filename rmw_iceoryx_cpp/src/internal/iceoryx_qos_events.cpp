@@ -0,0 +1,134 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rcutils/error_handling.h"
+
+#include "rmw/events_statuses/events_statuses.h"
+#include "rmw/impl/cpp/macros.hpp"
+
+#include "../iceoryx_qos_events.hpp"
+#include "../types/iceoryx_node.hpp"
+#include "../types/iceoryx_publisher.hpp"
+#include "../types/iceoryx_subscription.hpp"
+
+namespace rmw_iceoryx_cpp
+{
+std::atomic<uint64_t> & graph_generation()
+{
+  static std::atomic<uint64_t> generation{0U};
+  return generation;
+}
+
+bool update_qos_event(
+  const rmw_event_t * event,
+  rcutils_time_point_value_t now,
+  rcutils_duration_value_t & time_until_update)
+{
+  time_until_update = IceoryxDeadline::NO_UPDATE_NEEDED;
+
+  switch (event->event_type) {
+    case RMW_EVENT_OFFERED_DEADLINE_MISSED:
+      {
+        auto iceoryx_publisher = static_cast<IceoryxPublisher *>(event->data);
+        time_until_update = iceoryx_publisher->deadline_.update(now);
+        return iceoryx_publisher->deadline_.has_changed();
+      }
+    case RMW_EVENT_LIVELINESS_LOST:
+      {
+        auto iceoryx_publisher = static_cast<IceoryxPublisher *>(event->data);
+        time_until_update = iceoryx_publisher->liveliness_.update(
+          now, iceoryx_publisher->deadline_.last_activity());
+        return iceoryx_publisher->liveliness_.has_changed();
+      }
+    case RMW_EVENT_LIVELINESS_CHANGED:
+      {
+        // a graph change triggers the subscription after it was stored as the latest one
+        auto iceoryx_subscription = static_cast<IceoryxSubscription *>(event->data);
+        if (iceoryx_subscription->graph_change_notifier_) {
+          auto change = iceoryx_subscription->graph_change_notifier_->latest_change();
+          if (change) {
+            iceoryx_subscription->liveliness_.update(*change, iceoryx_subscription->topic_name_);
+          }
+        }
+        return iceoryx_subscription->liveliness_.has_changed();
+      }
+    case RMW_EVENT_REQUESTED_DEADLINE_MISSED:
+      {
+        auto iceoryx_subscription = static_cast<IceoryxSubscription *>(event->data);
+        if (!iceoryx_subscription->deadline_.is_enabled()) {
+          return false;
+        }
+        // a sample waiting in the queue was received in time, even if it is not yet taken
+        if (iceoryx_subscription->iceoryx_receiver_->hasData()) {
+          iceoryx_subscription->deadline_.notify(now);
+        }
+        time_until_update = iceoryx_subscription->deadline_.update(now);
+        return iceoryx_subscription->deadline_.has_changed();
+      }
+    default:
+      return false;
+  }
+}
+
+rmw_ret_t take_qos_event(const rmw_event_t * event, void * event_info, bool * taken)
+{
+  *taken = false;
+
+  rcutils_time_point_value_t now{0};
+  if (RCUTILS_RET_OK != rcutils_system_time_now(&now)) {
+    RMW_SET_ERROR_MSG("failed to get the current time");
+    return RMW_RET_ERROR;
+  }
+
+  rcutils_duration_value_t time_until_update{0};
+  update_qos_event(event, now, time_until_update);
+
+  switch (event->event_type) {
+    case RMW_EVENT_OFFERED_DEADLINE_MISSED:
+      {
+        auto status = static_cast<rmw_offered_deadline_missed_status_t *>(event_info);
+        static_cast<IceoryxPublisher *>(event->data)->deadline_.take(
+          status->total_count, status->total_count_change);
+        *taken = true;
+        return RMW_RET_OK;
+      }
+    case RMW_EVENT_LIVELINESS_LOST:
+      {
+        static_cast<IceoryxPublisher *>(event->data)->liveliness_.take(
+          *static_cast<rmw_liveliness_lost_status_t *>(event_info));
+        *taken = true;
+        return RMW_RET_OK;
+      }
+    case RMW_EVENT_LIVELINESS_CHANGED:
+      {
+        static_cast<IceoryxSubscription *>(event->data)->liveliness_.take(
+          *static_cast<rmw_liveliness_changed_status_t *>(event_info));
+        *taken = true;
+        return RMW_RET_OK;
+      }
+    case RMW_EVENT_REQUESTED_DEADLINE_MISSED:
+      {
+        auto status = static_cast<rmw_requested_deadline_missed_status_t *>(event_info);
+        static_cast<IceoryxSubscription *>(event->data)->deadline_.take(
+          status->total_count, status->total_count_change);
+        *taken = true;
+        return RMW_RET_OK;
+      }
+    default:
+      RMW_SET_ERROR_MSG("event type is not supported by rmw_iceoryx_cpp");
+      return RMW_RET_UNSUPPORTED;
+  }
+}
+
+}  // namespace rmw_iceoryx_cpp
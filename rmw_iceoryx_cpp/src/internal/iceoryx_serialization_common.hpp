@@ -16,6 +16,7 @@
 #define INTERNAL__ICEORYX_SERIALIZATION_COMMON_HPP_
 
 #include <stdarg.h>
+#include <cstring>
 #include <stdexcept>
 #include <tuple>
 #include <utility>
@@ -39,13 +40,48 @@ static inline void debug_log(const char * format, ...)
 #endif
 }
 
-inline void push_sequence_size(std::vector<char> & payloadVector, uint32_t array_size)
+/// @brief Sink for the serializers. Without a data pointer it only counts the bytes, which
+///        allows to loan a chunk of the exact serialized size and to serialize into it afterwards.
+class SerializationBuffer
+{
+public:
+  /// @brief Creates a buffer which only counts the serialized size
+  SerializationBuffer() = default;
+
+  SerializationBuffer(char * data, size_t capacity)
+  : data_(data), capacity_(capacity)
+  {
+  }
+
+  void append(const char * source, size_t size)
+  {
+    if (data_) {
+      if (size_ + size > capacity_) {
+        throw std::runtime_error("serialization buffer is too small");
+      }
+      memcpy(data_ + size_, source, size);
+    }
+    size_ += size;
+  }
+
+  size_t size() const
+  {
+    return size_;
+  }
+
+private:
+  char * data_{nullptr};
+  size_t capacity_{0U};
+  size_t size_{0U};
+};
+
+inline void push_sequence_size(SerializationBuffer & payload, uint32_t array_size)
 {
   const uint32_t check = 101;
   const char * sizePtr = reinterpret_cast<const char *>(&array_size);
   const char * checkPtr = reinterpret_cast<const char *>(&check);
-  payloadVector.insert(payloadVector.end(), checkPtr, checkPtr + sizeof(check));
-  payloadVector.insert(payloadVector.end(), sizePtr, sizePtr + sizeof(array_size));
+  payload.append(checkPtr, sizeof(check));
+  payload.append(sizePtr, sizeof(array_size));
 }
 
 inline std::pair<const char *, uint32_t> pop_sequence_size(const char * serialized_msg)
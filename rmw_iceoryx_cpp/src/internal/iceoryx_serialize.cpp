@@ -35,61 +35,159 @@
 
 namespace rmw_iceoryx_cpp
 {
-
-void serialize(
+namespace
+{
+void serialize_message(
   const void * ros_message,
   const rosidl_message_type_support_t * type_supports,
-  std::vector<char> & payload_vector)
+  SerializationBuffer & buffer)
 {
   auto ts = get_type_support(type_supports);
 
   if (ts.first == TypeSupportLanguage::CPP) {
     auto members =
       static_cast<const rosidl_typesupport_introspection_cpp::MessageMembers *>(ts.second->data);
-    rmw_iceoryx_cpp::details_cpp::serialize(ros_message, members, payload_vector);
+    rmw_iceoryx_cpp::details_cpp::serialize(ros_message, members, buffer);
   } else if (ts.first == TypeSupportLanguage::C) {
     auto members =
       static_cast<const rosidl_typesupport_introspection_c__MessageMembers *>(ts.second->data);
-    rmw_iceoryx_cpp::details_c::serialize(ros_message, members, payload_vector);
+    rmw_iceoryx_cpp::details_c::serialize(ros_message, members, buffer);
   }
 }
 
-void serializeRequest(
+void serialize_request(
   const void * ros_message,
   const rosidl_service_type_support_t * type_supports,
-  std::vector<char> & payload_vector)
+  SerializationBuffer & buffer)
 {
   auto ts = get_type_support(type_supports);
 
   if (ts.first == TypeSupportLanguage::CPP) {
     auto members =
       static_cast<const rosidl_typesupport_introspection_cpp::ServiceMembers *>(ts.second->data);
-    rmw_iceoryx_cpp::details_cpp::serialize(ros_message, members->request_members_, payload_vector);
+    rmw_iceoryx_cpp::details_cpp::serialize(ros_message, members->request_members_, buffer);
   } else if (ts.first == TypeSupportLanguage::C) {
     auto members =
       static_cast<const rosidl_typesupport_introspection_c__ServiceMembers *>(ts.second->data);
-    rmw_iceoryx_cpp::details_c::serialize(ros_message, members->request_members_, payload_vector);
+    rmw_iceoryx_cpp::details_c::serialize(ros_message, members->request_members_, buffer);
   }
 }
 
-void serializeResponse(
+void serialize_response(
   const void * ros_message,
   const rosidl_service_type_support_t * type_supports,
-  std::vector<char> & payload_vector)
+  SerializationBuffer & buffer)
 {
   auto ts = get_type_support(type_supports);
 
   if (ts.first == TypeSupportLanguage::CPP) {
     auto members =
       static_cast<const rosidl_typesupport_introspection_cpp::ServiceMembers *>(ts.second->data);
-    rmw_iceoryx_cpp::details_cpp::serialize(
-      ros_message, members->response_members_,
-      payload_vector);
+    rmw_iceoryx_cpp::details_cpp::serialize(ros_message, members->response_members_, buffer);
   } else if (ts.first == TypeSupportLanguage::C) {
     auto members =
       static_cast<const rosidl_typesupport_introspection_c__ServiceMembers *>(ts.second->data);
-    rmw_iceoryx_cpp::details_c::serialize(ros_message, members->response_members_, payload_vector);
+    rmw_iceoryx_cpp::details_c::serialize(ros_message, members->response_members_, buffer);
   }
 }
 
+/// @brief Counts the size first so that the vector is resized only once
+template<typename TypeSupportT, typename SerializeT>
+void serialize_into_vector(
+  const void * ros_message,
+  const TypeSupportT * type_supports,
+  std::vector<char> & payload_vector,
+  SerializeT serialize_function)
+{
+  SerializationBuffer counter;
+  serialize_function(ros_message, type_supports, counter);
+
+  auto offset = payload_vector.size();
+  payload_vector.resize(offset + counter.size());
+  SerializationBuffer buffer(payload_vector.data() + offset, counter.size());
+  serialize_function(ros_message, type_supports, buffer);
+}
+}  // namespace
+
+void serialize(
+  const void * ros_message,
+  const rosidl_message_type_support_t * type_supports,
+  std::vector<char> & payload_vector)
+{
+  serialize_into_vector(ros_message, type_supports, payload_vector, serialize_message);
+}
+
+void serializeRequest(
+  const void * ros_message,
+  const rosidl_service_type_support_t * type_supports,
+  std::vector<char> & payload_vector)
+{
+  serialize_into_vector(ros_message, type_supports, payload_vector, serialize_request);
+}
+
+void serializeResponse(
+  const void * ros_message,
+  const rosidl_service_type_support_t * type_supports,
+  std::vector<char> & payload_vector)
+{
+  serialize_into_vector(ros_message, type_supports, payload_vector, serialize_response);
+}
+
+size_t get_serialized_size(
+  const void * ros_message,
+  const rosidl_message_type_support_t * type_supports)
+{
+  SerializationBuffer counter;
+  serialize_message(ros_message, type_supports, counter);
+  return counter.size();
+}
+
+size_t get_serialized_request_size(
+  const void * ros_request,
+  const rosidl_service_type_support_t * type_supports)
+{
+  SerializationBuffer counter;
+  serialize_request(ros_request, type_supports, counter);
+  return counter.size();
+}
+
+size_t get_serialized_response_size(
+  const void * ros_response,
+  const rosidl_service_type_support_t * type_supports)
+{
+  SerializationBuffer counter;
+  serialize_response(ros_response, type_supports, counter);
+  return counter.size();
+}
+
+void serialize(
+  const void * ros_message,
+  const rosidl_message_type_support_t * type_supports,
+  char * buffer,
+  size_t buffer_size)
+{
+  SerializationBuffer serialization_buffer(buffer, buffer_size);
+  serialize_message(ros_message, type_supports, serialization_buffer);
+}
+
+void serializeRequest(
+  const void * ros_request,
+  const rosidl_service_type_support_t * type_supports,
+  char * buffer,
+  size_t buffer_size)
+{
+  SerializationBuffer serialization_buffer(buffer, buffer_size);
+  serialize_request(ros_request, type_supports, serialization_buffer);
+}
+
+void serializeResponse(
+  const void * ros_response,
+  const rosidl_service_type_support_t * type_supports,
+  char * buffer,
+  size_t buffer_size)
+{
+  SerializationBuffer serialization_buffer(buffer, buffer_size);
+  serialize_response(ros_response, type_supports, serialization_buffer);
+}
+
 }  // namespace rmw_iceoryx_cpp
@@ -36,28 +36,28 @@ template<
   class T,
   size_t SizeT = sizeof(T)
 >
-void serialize_sequence(std::vector<char> & serialized_msg, const char * ros_message_field);
+void serialize_sequence(SerializationBuffer & serialized_msg, const char * ros_message_field);
 
 template<
   class T,
   size_t SizeT = sizeof(T)
 >
 void serialize_element(
-  std::vector<char> & serialized_msg,
+  SerializationBuffer & serialized_msg,
   const char * ros_message_field)
 {
   debug_log("serializing data element of %u bytes\n", SizeT);
-  serialized_msg.insert(serialized_msg.end(), ros_message_field, ros_message_field + SizeT);
+  serialized_msg.append(ros_message_field, SizeT);
 }
 
 template<>
 void serialize_element<rosidl_runtime_c__String, sizeof(rosidl_runtime_c__String)>(
-  std::vector<char> & serialized_msg,
+  SerializationBuffer & serialized_msg,
   const char * ros_message_field)
 {
   auto string = reinterpret_cast<const rosidl_runtime_c__String *>(ros_message_field);
   push_sequence_size(serialized_msg, string->size);
-  serialized_msg.insert(serialized_msg.end(), string->data, string->data + string->size);
+  serialized_msg.append(string->data, string->size);
 }
 
 template<
@@ -65,7 +65,7 @@ template<
   size_t SizeT = sizeof(T)
 >
 void serialize_array(
-  std::vector<char> & serialized_msg,
+  SerializationBuffer & serialized_msg,
   const char * ros_message_field,
   uint32_t size)
 {
@@ -80,7 +80,7 @@ template<
   class T,
   size_t SizeT
 >
-void serialize_sequence(std::vector<char> & serialized_msg, const char * ros_message_field)
+void serialize_sequence(SerializationBuffer & serialized_msg, const char * ros_message_field)
 {
   auto sequence =
     reinterpret_cast<const typename traits::sequence_type<T>::type *>(ros_message_field);
@@ -94,7 +94,7 @@ void serialize_sequence(std::vector<char> & serialized_msg, const char * ros_mes
 template<typename T>
 void serialize_message_field(
   const rosidl_typesupport_introspection_c__MessageMember * member,
-  std::vector<char> & serialized_msg,
+  SerializationBuffer & serialized_msg,
   const char * ros_message_field)
 {
   debug_log("serializing message field %s\n", member->name_);
@@ -110,7 +110,7 @@ void serialize_message_field(
 void serialize(
   const void * ros_message,
   const rosidl_typesupport_introspection_c__MessageMembers * members,
-  std::vector<char> & serialized_msg)
+  SerializationBuffer & serialized_msg)
 {
   assert(members);
   assert(ros_message);
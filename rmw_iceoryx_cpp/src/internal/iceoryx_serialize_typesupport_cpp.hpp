@@ -40,7 +40,7 @@ template<
   uint32_t SizeT = sizeof(T)
 >
 void serialize_element(
-  std::vector<char> & serialized_msg,
+  SerializationBuffer & serialized_msg,
   const char * ros_message_field);
 
 template<
@@ -48,7 +48,7 @@ template<
   uint32_t SizeT = sizeof(T)
 >
 void serialize_array(
-  std::vector<char> & serialized_msg,
+  SerializationBuffer & serialized_msg,
   const void * ros_message_field,
   uint32_t size);
 
@@ -58,7 +58,7 @@ template<
   class ContainerT = std::vector<T>
 >
 void serialize_sequence(
-  std::vector<char> & serialized_msg,
+  SerializationBuffer & serialized_msg,
   const void * ros_message_field);
 
 // Implementation
@@ -67,16 +67,16 @@ template<
   uint32_t SizeT
 >
 void serialize_element(
-  std::vector<char> & serialized_msg,
+  SerializationBuffer & serialized_msg,
   const char * ros_message_field)
 {
   debug_log("serializing data element of %u bytes\n", SizeT);
-  serialized_msg.insert(serialized_msg.end(), ros_message_field, ros_message_field + SizeT);
+  serialized_msg.append(ros_message_field, SizeT);
 }
 
 template<>
 void serialize_element<std::string, sizeof(std::string)>(
-  std::vector<char> & serialized_msg,
+  SerializationBuffer & serialized_msg,
   const char * ros_message_field)
 {
   serialize_sequence<char, sizeof(char), std::string>(serialized_msg, ros_message_field);
@@ -84,7 +84,7 @@ void serialize_element<std::string, sizeof(std::string)>(
 
 template<>
 void serialize_element<std::wstring, sizeof(std::wstring)>(
-  std::vector<char> & serialized_msg,
+  SerializationBuffer & serialized_msg,
   const char * ros_message_field)
 {
   serialize_sequence<wchar_t, sizeof(wchar_t), std::wstring>(serialized_msg, ros_message_field);
@@ -95,7 +95,7 @@ template<
   uint32_t SizeT
 >
 void serialize_array(
-  std::vector<char> & serialized_msg,
+  SerializationBuffer & serialized_msg,
   const void * ros_message_field,
   uint32_t size)
 {
@@ -112,7 +112,7 @@ template<
   uint32_t SizeT,
   class ContainerT
 >
-void serialize_sequence(std::vector<char> & serialized_msg, const void * ros_message_field)
+void serialize_sequence(SerializationBuffer & serialized_msg, const void * ros_message_field)
 {
   auto sequence = reinterpret_cast<const ContainerT *>(ros_message_field);
   uint32_t size = sequence->size();
@@ -128,7 +128,7 @@ void serialize_sequence(std::vector<char> & serialized_msg, const void * ros_mes
 template<typename T>
 void serialize_message_field(
   const rosidl_typesupport_introspection_cpp::MessageMember * member,
-  std::vector<char> & serialized_msg,
+  SerializationBuffer & serialized_msg,
   const char * ros_message_field)
 {
   debug_log("serializing message field %s\n", member->name_);
@@ -144,7 +144,7 @@ void serialize_message_field(
 void serialize(
   const void * ros_message,
   const rosidl_typesupport_introspection_cpp::MessageMembers * members,
-  std::vector<char> & serialized_msg)
+  SerializationBuffer & serialized_msg)
 {
   assert(members);
   assert(ros_message);
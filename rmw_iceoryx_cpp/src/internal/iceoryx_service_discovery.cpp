@@ -0,0 +1,258 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "rcutils/logging_macros.h"
+
+#include "rmw_iceoryx_cpp/iceoryx_name_conversion.hpp"
+#include "rmw_iceoryx_cpp/iceoryx_service_discovery.hpp"
+
+namespace rmw_iceoryx_cpp
+{
+namespace
+{
+/// @brief Servers and clients of this process indexed by the full name of their node. A node
+///        may have several endpoints for the same service, hence the descriptions are a list.
+class ServiceEndpointRegistry
+{
+public:
+  void add(
+    ServiceEndpointKind kind,
+    const iox::capro::ServiceDescription & service_description,
+    const std::string & node_full_name)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    endpoints(kind)[node_full_name].push_back(service_description);
+  }
+
+  void remove(
+    ServiceEndpointKind kind,
+    const iox::capro::ServiceDescription & service_description,
+    const std::string & node_full_name)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto & nodes = endpoints(kind);
+    auto node = nodes.find(node_full_name);
+    if (node == nodes.end()) {
+      return;
+    }
+    auto & descriptions = node->second;
+    auto description = std::find(descriptions.begin(), descriptions.end(), service_description);
+    if (description != descriptions.end()) {
+      descriptions.erase(description);
+    }
+    if (descriptions.empty()) {
+      nodes.erase(node);
+    }
+  }
+
+  std::map<std::string, std::string>
+  names_n_types_of_node(ServiceEndpointKind kind, const std::string & node_full_name)
+  {
+    std::map<std::string, std::string> names_n_types;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto & nodes = endpoints(kind);
+    auto node = nodes.find(node_full_name);
+    if (node != nodes.end()) {
+      add_names_n_types(node->second, names_n_types);
+    }
+    return names_n_types;
+  }
+
+  std::map<std::string, std::string> names_n_types(ServiceEndpointKind kind)
+  {
+    std::map<std::string, std::string> names_n_types;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto & node : endpoints(kind)) {
+      add_names_n_types(node.second, names_n_types);
+    }
+    return names_n_types;
+  }
+
+private:
+  using NodeEndpoints =
+    std::unordered_map<std::string, std::vector<iox::capro::ServiceDescription>>;
+
+  NodeEndpoints & endpoints(ServiceEndpointKind kind)
+  {
+    return (kind == ServiceEndpointKind::SERVER) ? servers_ : clients_;
+  }
+
+  static void add_names_n_types(
+    const std::vector<iox::capro::ServiceDescription> & descriptions,
+    std::map<std::string, std::string> & names_n_types)
+  {
+    for (auto & description : descriptions) {
+      auto name_n_type = get_interned_name_n_type(
+        description.getServiceIDString(), description.getInstanceIDString(),
+        description.getEventIDString());
+      names_n_types[name_n_type->name_] = name_n_type->type_;
+    }
+  }
+
+  std::mutex mutex_;
+  NodeEndpoints servers_;
+  NodeEndpoints clients_;
+};
+
+ServiceEndpointRegistry & service_endpoint_registry()
+{
+  static ServiceEndpointRegistry registry;
+  return registry;
+}
+
+/// @brief Joins namespace and name of a node like the iceoryx node names of its ports, which
+///        get_name_n_space_from_node_full_name splits again
+std::string node_full_name(const char * node_name, const char * node_namespace)
+{
+  return std::string(node_namespace) + std::string(node_name);
+}
+}  // namespace
+
+size_t ServiceDescriptionHash::operator()(
+  const iox::capro::ServiceDescription & service_description) const
+{
+  // FNV-1a over the three ids, separated by a zero byte
+  uint64_t hash = 14695981039346656037ULL;
+  auto add = [&hash](const char * id) {
+      for (; *id != '\0'; ++id) {
+        hash = (hash ^ static_cast<unsigned char>(*id)) * 1099511628211ULL;
+      }
+      hash = hash * 1099511628211ULL;
+    };
+  add(service_description.getServiceIDString().c_str());
+  add(service_description.getInstanceIDString().c_str());
+  add(service_description.getEventIDString().c_str());
+  return static_cast<size_t>(hash);
+}
+
+std::shared_ptr<const ServiceDiscoverySnapshot>
+find_offered_servers(iox::runtime::ServiceDiscovery & service_discovery)
+{
+  auto snapshot = std::make_shared<ServiceDiscoverySnapshot>();
+  service_discovery.findService(
+    iox::cxx::nullopt,
+    iox::cxx::nullopt,
+    iox::cxx::nullopt,
+    [&](const iox::capro::ServiceDescription & server) {
+      snapshot->servers_.insert(server);
+      auto name_n_type = get_interned_name_n_type(
+        server.getServiceIDString(), server.getInstanceIDString(), server.getEventIDString());
+      snapshot->names_n_types_[name_n_type->name_] = name_n_type->type_;
+    },
+    iox::popo::MessagingPattern::REQ_RES);
+  return snapshot;
+}
+
+ServiceDiscoveryCache::ServiceDiscoveryCache(iox::popo::Listener & listener)
+: snapshot_(std::make_shared<const ServiceDiscoverySnapshot>()),
+  listener_(listener)
+{
+  // attach before the first search, so that no server which is offered in between is missed
+  listener_.attachEvent(
+    service_discovery_, iox::runtime::ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED,
+    iox::popo::createNotificationCallback(ServiceDiscoveryCache::callback, *this))
+  .or_else(
+    [](auto) {
+      RCUTILS_LOG_ERROR_NAMED(
+        "rmw_iceoryx_cpp", "Unable to attach to the service discovery, servers which are "
+        "offered from now on won't be discovered");
+    });
+  update();
+}
+
+ServiceDiscoveryCache::~ServiceDiscoveryCache()
+{
+  listener_.detachEvent(
+    service_discovery_, iox::runtime::ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED);
+}
+
+std::shared_ptr<const ServiceDiscoverySnapshot>
+ServiceDiscoveryCache::snapshot() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return snapshot_;
+}
+
+bool
+ServiceDiscoveryCache::is_server_offered(
+  const iox::capro::ServiceDescription & service_description) const
+{
+  return snapshot()->servers_.count(service_description) > 0U;
+}
+
+void
+ServiceDiscoveryCache::callback(iox::runtime::ServiceDiscovery *, ServiceDiscoveryCache * self)
+{
+  self->update();
+}
+
+void
+ServiceDiscoveryCache::update()
+{
+  // the listener thread and the constructor may search at the same time
+  std::lock_guard<std::mutex> update_lock(update_mutex_);
+  auto snapshot = find_offered_servers(service_discovery_);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  snapshot_ = std::move(snapshot);
+}
+
+void
+register_service_endpoint(
+  ServiceEndpointKind kind,
+  const iox::capro::ServiceDescription & service_description,
+  const char * node_name,
+  const char * node_namespace)
+{
+  service_endpoint_registry().add(
+    kind, service_description, node_full_name(node_name, node_namespace));
+}
+
+void
+unregister_service_endpoint(
+  ServiceEndpointKind kind,
+  const iox::capro::ServiceDescription & service_description,
+  const char * node_name,
+  const char * node_namespace)
+{
+  service_endpoint_registry().remove(
+    kind, service_description, node_full_name(node_name, node_namespace));
+}
+
+std::map<std::string, std::string>
+get_service_names_and_types_of_node(
+  ServiceEndpointKind kind,
+  const char * node_name,
+  const char * node_namespace)
+{
+  return service_endpoint_registry().names_n_types_of_node(
+    kind, node_full_name(node_name, node_namespace));
+}
+
+std::map<std::string, std::string>
+get_client_service_names_and_types()
+{
+  return service_endpoint_registry().names_n_types(ServiceEndpointKind::CLIENT);
+}
+
+}  // namespace rmw_iceoryx_cpp
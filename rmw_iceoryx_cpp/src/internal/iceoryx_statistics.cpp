@@ -0,0 +1,69 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rcutils/error_handling.h"
+
+#include "rmw/impl/cpp/macros.hpp"
+#include "rmw/rmw.h"
+
+#include "rmw_iceoryx_cpp/iceoryx_statistics.hpp"
+
+#include "../types/iceoryx_publisher.hpp"
+#include "../types/iceoryx_server.hpp"
+
+namespace rmw_iceoryx_cpp
+{
+rmw_ret_t
+get_skipped_publish_count(const rmw_publisher_t * publisher, uint64_t * count)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(publisher, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(count, RMW_RET_INVALID_ARGUMENT);
+
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    get_skipped_publish_count
+    : publisher, publisher->implementation_identifier,
+    rmw_get_implementation_identifier(), return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+
+  auto iceoryx_publisher = static_cast<IceoryxPublisher *>(publisher->data);
+  if (!iceoryx_publisher) {
+    RMW_SET_ERROR_MSG("publisher data is null");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  *count = iceoryx_publisher->skipped_publish_count_.load(std::memory_order_relaxed);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+get_reclaimed_request_count(const rmw_service_t * service, uint64_t * count)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(service, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(count, RMW_RET_INVALID_ARGUMENT);
+
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    get_reclaimed_request_count
+    : service, service->implementation_identifier,
+    rmw_get_implementation_identifier(), return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+
+  auto iceoryx_server = static_cast<IceoryxServer *>(service->data);
+  if (!iceoryx_server) {
+    RMW_SET_ERROR_MSG("service data is null");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  *count = iceoryx_server->reclaimed_request_count_.load(std::memory_order_relaxed);
+  return RMW_RET_OK;
+}
+
+}  // namespace rmw_iceoryx_cpp
@@ -17,23 +17,18 @@
 #include <string>
 #include <vector>
 
-#include "iceoryx_posh/popo/untyped_subscriber.hpp"
-#include "iceoryx_posh/roudi/introspection_types.hpp"
-
 #include "rcutils/logging_macros.h"
 #include "rcutils/strdup.h"
 
 #include "rmw/impl/cpp/macros.hpp"
 
-#include "rmw_iceoryx_cpp/iceoryx_name_conversion.hpp"
+#include "rmw_iceoryx_cpp/iceoryx_graph_cache.hpp"
+#include "rmw_iceoryx_cpp/iceoryx_service_discovery.hpp"
 #include "rmw_iceoryx_cpp/iceoryx_topic_names_and_types.hpp"
 
-#include "iceoryx_posh/runtime/service_discovery.hpp"
-
 namespace rmw_iceoryx_cpp
 {
 
-/// @todo Use the new service discovery API of iceoryx v2.0 here instead of introspection topics
 void fill_topic_containers(
   std::map<std::string, std::string> & names_n_types_,
   std::map<std::string, std::vector<std::string>> & subscribers_topics_,
@@ -41,226 +36,80 @@ void fill_topic_containers(
   std::map<std::string, std::vector<std::string>> & topic_subscribers_,
   std::map<std::string, std::vector<std::string>> & topic_publishers_)
 {
-  static iox::popo::UntypedSubscriber port_receiver(iox::roudi::IntrospectionPortService,
-    iox::popo::SubscriberOptions{1U, 1U, "", true});
-  static std::map<std::string, std::string> names_n_types;
-  static std::map<std::string, std::vector<std::string>> subscribers_topics;
-  static std::map<std::string, std::vector<std::string>> publishers_topics;
-  static std::map<std::string, std::vector<std::string>> topic_subscribers;
-  static std::map<std::string, std::vector<std::string>> topic_publishers;
-
-  bool updated = false;
-  if (iox::SubscribeState::SUBSCRIBED != port_receiver.getSubscriptionState()) {
-    port_receiver.subscribe();
-    // wait for delivery on subscribe
-    while (!port_receiver.hasData()) {
-      std::this_thread::sleep_for(std::chrono::milliseconds(50));
-    }
-    updated = true;
-  } else {
-    updated = port_receiver.hasData();
-  }
-
-  if (updated) {
-    // get the latest sample
-    const void * previous_user_payload = nullptr;
-
-    while (port_receiver.take()
-      .and_then(
-        [&](const void * userPayload) {
-          if (previous_user_payload) {
-            port_receiver.release(previous_user_payload);
-          }
-          previous_user_payload = userPayload;
-        })
-      .or_else(
-        [](auto & result) {
-          if (result != iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE) {
-            RMW_SET_ERROR_MSG("failed to take message");
-          }
-        }))
-
-    {
-    }
-
-    if (previous_user_payload) {
-      const iox::roudi::PortIntrospectionFieldTopic * port_sample =
-        static_cast<const iox::roudi::PortIntrospectionFieldTopic *>(previous_user_payload);
-
-      names_n_types.clear();
-      subscribers_topics.clear();
-      publishers_topics.clear();
-
-      for (auto & receiver : port_sample->m_subscriberList) {
-        auto name_and_type = rmw_iceoryx_cpp::get_name_n_type_from_service_description(
-          std::string(receiver.m_caproServiceID.c_str()),
-          std::string(receiver.m_caproInstanceID.c_str()),
-          std::string(receiver.m_caproEventMethodID.c_str()));
+  auto graph = get_graph_snapshot();
 
-        names_n_types[std::get<0>(name_and_type)] = std::get<1>(name_and_type);
-        subscribers_topics[std::string(receiver.m_node.c_str())].push_back(
-          std::get<0>(
-            name_and_type));
-        topic_subscribers[std::get<0>(name_and_type)].push_back(
-          std::string(receiver.m_node.c_str()));
-      }
-      for (auto & sender : port_sample->m_publisherList) {
-        auto name_and_type = rmw_iceoryx_cpp::get_name_n_type_from_service_description(
-          std::string(sender.m_caproServiceID.c_str()),
-          std::string(sender.m_caproInstanceID.c_str()),
-          std::string(sender.m_caproEventMethodID.c_str()));
-
-        names_n_types[std::get<0>(name_and_type)] = std::get<1>(name_and_type);
-        publishers_topics[std::string(sender.m_node.c_str())].push_back(
-          std::get<0>(
-            name_and_type));
-        topic_publishers[std::get<0>(name_and_type)].push_back(std::string(sender.m_node.c_str()));
-      }
-      port_receiver.release(previous_user_payload);
-    }
-  }
-
-  names_n_types_ = names_n_types;
-  subscribers_topics_ = subscribers_topics;
-  publishers_topics_ = publishers_topics;
-  topic_subscribers_ = topic_subscribers;
-  topic_publishers_ = topic_publishers;
+  names_n_types_ = graph->names_n_types_;
+  subscribers_topics_ = graph->subscribers_topics_;
+  publishers_topics_ = graph->publishers_topics_;
+  topic_subscribers_ = graph->topic_subscribers_;
+  topic_publishers_ = graph->topic_publishers_;
 }
 
 std::map<std::string, std::string> get_topic_names_and_types()
 {
-  std::map<std::string, std::string> names_n_types;
-  std::map<std::string, std::vector<std::string>> subscribers_topics;
-  std::map<std::string, std::vector<std::string>> publishers_topics;
-  std::map<std::string, std::vector<std::string>> topic_subscribers;
-  std::map<std::string, std::vector<std::string>> topic_publishers;
-
-  fill_topic_containers(
-    names_n_types, subscribers_topics, publishers_topics, topic_subscribers,
-    topic_publishers);
-
-  return names_n_types;
+  return get_graph_snapshot()->names_n_types_;
 }
 
 std::map<std::string, std::string> get_service_names_and_types()
 {
-  std::map<std::string, std::string> names_n_types;
-  // Currently, no possibility to query for clients..
-  std::map<std::string, std::vector<std::string>> clients_topics;
-  // Can be discovered via 'ServiceDiscovery'
-  std::map<std::string, std::vector<std::string>> servers_topics;
-  // Currently, no possibility to query for clients..
-  std::map<std::string, std::vector<std::string>> topic_clients;
-  // Can be discovered, but missing associated node
-  std::map<std::string, std::vector<std::string>> topic_servers;
-
-  std::vector<iox::capro::ServiceDescription> available_servers;
-
+  /// @todo There is no API to find out which 'ServiceDescription' is offered by which node and
+  /// clients can't be queried at all, hence only the servers are listed
+  // there is no context to take the cache from, hence the registry is searched once
   iox::runtime::ServiceDiscovery service_discovery;
-  service_discovery.findService(
-    iox::cxx::nullopt,
-    iox::cxx::nullopt,
-    iox::cxx::nullopt,
-    [&](auto & service_description) {available_servers.push_back(service_description);},
-    iox::popo::MessagingPattern::REQ_RES);
-
-  for (auto & server : available_servers) {
-    /// @todo Use structured bindings once all platforms are on C++17
-    std::string name;
-    std::string type;
-    std::tie(name, type) = rmw_iceoryx_cpp::get_name_n_type_from_service_description(
-      std::string(server.getServiceIDString().c_str()),
-      std::string(server.getInstanceIDString().c_str()),
-      std::string(server.getEventIDString().c_str()));
-
-    names_n_types[name] = type;
-    /// @todo There is no API to find out which 'ServiceDescription' is offered by which node,
-    /// for now we use 'NodeFoo'..
-    servers_topics[std::string("NodeFoo")].push_back(name);
-    topic_servers[name].push_back(std::string("NodeFoo"));
-  }
-
-  return names_n_types;
+  return find_offered_servers(service_discovery)->names_n_types_;
 }
 
 std::map<std::string, std::vector<std::string>> get_nodes_and_publishers()
 {
-  std::map<std::string, std::string> names_n_types;
-  std::map<std::string, std::vector<std::string>> subscribers_topics;
-  std::map<std::string, std::vector<std::string>> publishers_topics;
-  std::map<std::string, std::vector<std::string>> topic_subscribers;
-  std::map<std::string, std::vector<std::string>> topic_publishers;
-
-  fill_topic_containers(
-    names_n_types, subscribers_topics, publishers_topics, topic_subscribers,
-    topic_publishers);
-
-  return publishers_topics;
+  return get_graph_snapshot()->publishers_topics_;
 }
 
 std::map<std::string, std::vector<std::string>> get_nodes_and_subscribers()
 {
-  std::map<std::string, std::string> names_n_types;
-  std::map<std::string, std::vector<std::string>> subscribers_topics;
-  std::map<std::string, std::vector<std::string>> publishers_topics;
-  std::map<std::string, std::vector<std::string>> topic_subscribers;
-  std::map<std::string, std::vector<std::string>> topic_publishers;
-
-  fill_topic_containers(
-    names_n_types, subscribers_topics, publishers_topics, topic_subscribers,
-    topic_publishers);
-
-  return subscribers_topics;
+  return get_graph_snapshot()->subscribers_topics_;
 }
 
-std::map<std::string, std::string> get_publisher_names_and_types_of_node(
+namespace
+{
+std::map<std::string, std::string> get_names_and_types_of_node(
+  const GraphSnapshot & graph,
+  const std::map<std::string, std::vector<std::string>> & nodes_topics,
   const char * node_name,
   const char * node_namespace)
 {
-  std::map<std::string, std::string> names_n_types;
-  std::map<std::string, std::vector<std::string>> subscribers_topics;
-  std::map<std::string, std::vector<std::string>> publishers_topics;
-  std::map<std::string, std::vector<std::string>> topic_subscribers;
-  std::map<std::string, std::vector<std::string>> topic_publishers;
-
-  fill_topic_containers(
-    names_n_types, subscribers_topics, publishers_topics, topic_subscribers,
-    topic_publishers);
-
-  std::map<std::string, std::string> publisher_names_and_types;
+  std::map<std::string, std::string> names_and_types;
 
   std::string full_name = std::string(node_namespace) + std::string(node_name);
 
-  auto publisher_topics = publishers_topics[full_name];
-  for (auto topic : publisher_topics) {
-    publisher_names_and_types[topic] = names_n_types[topic];
+  auto node_topics = nodes_topics.find(full_name);
+  if (node_topics == nodes_topics.end()) {
+    return names_and_types;
+  }
+  for (auto & topic : node_topics->second) {
+    auto name_n_type = graph.names_n_types_.find(topic);
+    if (name_n_type != graph.names_n_types_.end()) {
+      names_and_types[topic] = name_n_type->second;
+    }
   }
-  return publisher_names_and_types;
+  return names_and_types;
 }
+}  // namespace
 
-std::map<std::string, std::string> get_subscription_names_and_types_of_node(
+std::map<std::string, std::string> get_publisher_names_and_types_of_node(
   const char * node_name,
   const char * node_namespace)
 {
-  std::map<std::string, std::string> names_n_types;
-  std::map<std::string, std::vector<std::string>> subscribers_topics;
-  std::map<std::string, std::vector<std::string>> publishers_topics;
-  std::map<std::string, std::vector<std::string>> topic_subscribers;
-  std::map<std::string, std::vector<std::string>> topic_publishers;
-
-  fill_topic_containers(
-    names_n_types, subscribers_topics, publishers_topics, topic_subscribers,
-    topic_publishers);
-
-  std::map<std::string, std::string> subscriber_names_and_types;
-
-  std::string full_name = std::string(node_namespace) + std::string(node_name);
+  auto graph = get_graph_snapshot();
+  return get_names_and_types_of_node(*graph, graph->publishers_topics_, node_name, node_namespace);
+}
 
-  auto subscriber_topics = subscribers_topics[full_name];
-  for (auto topic : subscriber_topics) {
-    subscriber_names_and_types[topic] = names_n_types[topic];
-  }
-  return subscriber_names_and_types;
+std::map<std::string, std::string> get_subscription_names_and_types_of_node(
+  const char * node_name,
+  const char * node_namespace)
+{
+  auto graph = get_graph_snapshot();
+  return get_names_and_types_of_node(
+    *graph, graph->subscribers_topics_, node_name, node_namespace);
 }
 
 rmw_ret_t fill_rmw_names_and_types(
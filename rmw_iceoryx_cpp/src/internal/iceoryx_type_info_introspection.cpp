@@ -423,4 +423,44 @@ void iceoryx_fini_message(
   }
 }
 
+void iceoryx_init_request(
+  const rosidl_service_type_support_t * type_supports,
+  void * request)
+{
+  auto ts = get_type_support(type_supports);
+
+  if (ts.first == TypeSupportLanguage::CPP) {
+    auto members =
+      static_cast<const rosidl_typesupport_introspection_cpp::ServiceMembers *>(ts.second->data);
+    members->request_members_->init_function(
+      request, rosidl_runtime_cpp::MessageInitialization::ALL);
+    return;
+  } else if (ts.first == TypeSupportLanguage::C) {
+    auto members =
+      static_cast<const rosidl_typesupport_introspection_c__ServiceMembers *>(ts.second->data);
+    members->request_members_->init_function(request, ROSIDL_RUNTIME_C_MSG_INIT_ALL);
+    return;
+  }
+}
+
+void iceoryx_init_response(
+  const rosidl_service_type_support_t * type_supports,
+  void * response)
+{
+  auto ts = get_type_support(type_supports);
+
+  if (ts.first == TypeSupportLanguage::CPP) {
+    auto members =
+      static_cast<const rosidl_typesupport_introspection_cpp::ServiceMembers *>(ts.second->data);
+    members->response_members_->init_function(
+      response, rosidl_runtime_cpp::MessageInitialization::ALL);
+    return;
+  } else if (ts.first == TypeSupportLanguage::C) {
+    auto members =
+      static_cast<const rosidl_typesupport_introspection_c__ServiceMembers *>(ts.second->data);
+    members->response_members_->init_function(response, ROSIDL_RUNTIME_C_MSG_INIT_ALL);
+    return;
+  }
+}
+
 }  // namespace rmw_iceoryx_cpp
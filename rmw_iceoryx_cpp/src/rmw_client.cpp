@@ -15,12 +15,15 @@
 
 #include <assert.h>
 
+#include <string>
+
 #include "rcutils/error_handling.h"
 
 #include "rmw/impl/cpp/macros.hpp"
 #include "rmw/rmw.h"
 
 #include "rmw_iceoryx_cpp/iceoryx_name_conversion.hpp"
+#include "rmw_iceoryx_cpp/iceoryx_service_discovery.hpp"
 
 #include "types/iceoryx_client.hpp"
 
@@ -109,7 +112,7 @@ rmw_create_client(
   }
   RMW_TRY_PLACEMENT_NEW(
     iceoryx_client_abstraction, iceoryx_client_abstraction,
-    cleanupAfterError(), IceoryxClient, type_supports, iceoryx_client);
+    cleanupAfterError(), IceoryxClient, type_supports, iceoryx_client, qos_policies->depth);
   if (returnOnError) {
     return nullptr;
   }
@@ -125,6 +128,11 @@ rmw_create_client(
     return nullptr;
   }
   memcpy(const_cast<char *>(rmw_client->service_name), service_name, strlen(service_name) + 1);
+
+  rmw_iceoryx_cpp::register_service_endpoint(
+    rmw_iceoryx_cpp::ServiceEndpointKind::CLIENT, service_description, node->name,
+    node->namespace_);
+
   return rmw_client;
 }
 
@@ -146,6 +154,10 @@ rmw_destroy_client(
   IceoryxClient * iceoryx_client_abstraction = static_cast<IceoryxClient *>(client->data);
   if (iceoryx_client_abstraction) {
     if (iceoryx_client_abstraction->iceoryx_client_) {
+      rmw_iceoryx_cpp::unregister_service_endpoint(
+        rmw_iceoryx_cpp::ServiceEndpointKind::CLIENT,
+        iceoryx_client_abstraction->iceoryx_client_->getServiceDescription(),
+        node->name, node->namespace_);
       RMW_TRY_DESTRUCTOR(
         iceoryx_client_abstraction->iceoryx_client_->~UntypedClient(),
         iceoryx_client_abstraction->iceoryx_client_,
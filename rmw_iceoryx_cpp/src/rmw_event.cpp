@@ -18,6 +18,9 @@
 #include "rmw/impl/cpp/macros.hpp"
 #include "rmw/rmw.h"
 
+#include "./types/iceoryx_publisher.hpp"
+#include "./types/iceoryx_subscription.hpp"
+
 extern "C"
 {
 rmw_ret_t
@@ -28,10 +31,26 @@ rmw_publisher_event_init(
 {
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(rmw_event, RMW_RET_ERROR);
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(publisher, RMW_RET_ERROR);
-  (void) event_type;
 
-  /// @todo add publisher events support
-  return RMW_RET_UNSUPPORTED;
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    rmw_publisher_event_init
+    : publisher, publisher->implementation_identifier,
+    rmw_get_implementation_identifier(), return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+
+  switch (event_type) {
+    case RMW_EVENT_OFFERED_DEADLINE_MISSED:
+    case RMW_EVENT_LIVELINESS_LOST:
+      break;
+    default:
+      RMW_SET_ERROR_MSG("publisher event type is not supported by rmw_iceoryx_cpp");
+      return RMW_RET_UNSUPPORTED;
+  }
+
+  // the event is evaluated lazily in 'rmw_wait', it only needs to know its publisher
+  rmw_event->implementation_identifier = rmw_get_implementation_identifier();
+  rmw_event->data = static_cast<IceoryxPublisher *>(publisher->data);
+  rmw_event->event_type = event_type;
+  return RMW_RET_OK;
 }
 
 rmw_ret_t
@@ -42,10 +61,25 @@ rmw_subscription_event_init(
 {
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(rmw_event, RMW_RET_ERROR);
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(subscription, RMW_RET_ERROR);
-  (void) event_type;
 
-  /// @todo add subscription events support
-  return RMW_RET_UNSUPPORTED;
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    rmw_subscription_event_init
+    : subscription, subscription->implementation_identifier,
+    rmw_get_implementation_identifier(), return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+
+  switch (event_type) {
+    case RMW_EVENT_REQUESTED_DEADLINE_MISSED:
+    case RMW_EVENT_LIVELINESS_CHANGED:
+      break;
+    default:
+      RMW_SET_ERROR_MSG("subscription event type is not supported by rmw_iceoryx_cpp");
+      return RMW_RET_UNSUPPORTED;
+  }
+
+  rmw_event->implementation_identifier = rmw_get_implementation_identifier();
+  rmw_event->data = static_cast<IceoryxSubscription *>(subscription->data);
+  rmw_event->event_type = event_type;
+  return RMW_RET_OK;
 }
 
 rmw_ret_t rmw_event_set_callback(
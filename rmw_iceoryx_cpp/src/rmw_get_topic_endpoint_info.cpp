@@ -42,12 +42,8 @@ rmw_ret_t rmw_get_publishers_info_by_topic(
     return rmw_ret;      // error already set
   }
 
-  auto iceoryx_publisher_endpoint_info =
-    rmw_iceoryx_cpp::get_publisher_end_info_of_topic(topic_name);
-
-  return rmw_iceoryx_cpp::fill_rmw_publisher_end_info(
-    publishers_info,
-    iceoryx_publisher_endpoint_info, allocator);
+  return rmw_iceoryx_cpp::fill_rmw_topic_endpoint_info(
+    publishers_info, topic_name, RMW_ENDPOINT_PUBLISHER, allocator);
 }
 
 rmw_ret_t rmw_get_subscriptions_info_by_topic(
@@ -70,11 +66,7 @@ rmw_ret_t rmw_get_subscriptions_info_by_topic(
     return rmw_ret;      // error already set
   }
 
-  auto iceoryx_subscriber_endpoint_info = rmw_iceoryx_cpp::get_subscriber_end_info_of_topic(
-    topic_name);
-
-  return rmw_iceoryx_cpp::fill_rmw_subscriber_end_info(
-    subscriptions_info, iceoryx_subscriber_endpoint_info,
-    allocator);
+  return rmw_iceoryx_cpp::fill_rmw_topic_endpoint_info(
+    subscriptions_info, topic_name, RMW_ENDPOINT_SUBSCRIPTION, allocator);
 }
 }  // extern "C"
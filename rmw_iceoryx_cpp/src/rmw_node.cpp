@@ -19,6 +19,7 @@
 
 #include "rmw/allocators.h"
 
+#include "./types/iceoryx_context.hpp"
 #include "./types/iceoryx_node.hpp"
 
 extern "C"
@@ -37,6 +38,10 @@ rmw_create_node(
     rmw_create_node
     : context, context->implementation_identifier,
     rmw_get_implementation_identifier(), return nullptr);
+  if (!context->impl) {
+    RMW_SET_ERROR_MSG("context is not initialized");
+    return nullptr;
+  }
 
   std::string full_name = std::string(namespace_) + std::string(name);
   rmw_guard_condition_t * guard_condition = nullptr;
@@ -58,16 +63,10 @@ rmw_create_node(
     goto fail;
   }
 
-  /// @todo only use one GraphChangeNotifier for all nodes
-  graph_change_notifier =
-    static_cast<IceoryxGraphChangeNotifier *>(rmw_allocate(sizeof(IceoryxGraphChangeNotifier)));
-  if (!graph_change_notifier) {
-    RMW_SET_ERROR_MSG("failed to allocate memory for graph change notifier");
+  graph_change_notifier = &context->impl->graph_change_notifier_;
+  if (RMW_RET_OK != graph_change_notifier->attach(guard_condition)) {
     goto fail;
   }
-  RMW_TRY_PLACEMENT_NEW(
-    graph_change_notifier, graph_change_notifier, goto fail,
-    IceoryxGraphChangeNotifier, guard_condition)
 
   // allocate iceoryx_runnable
   iceoryx_runnable =
@@ -89,7 +88,7 @@ rmw_create_node(
   }
   RMW_TRY_PLACEMENT_NEW(
     node_info, node_info, goto fail, IceoryxNodeInfo, guard_condition,
-    graph_change_notifier, iceoryx_runnable)
+    graph_change_notifier, &context->impl->service_discovery_cache_, iceoryx_runnable)
 
   node_handle->data = node_info;
 
@@ -112,12 +111,10 @@ rmw_create_node(
 
 fail:
   if (node_handle) {
-    if (graph_change_notifier) {
-      RMW_TRY_DESTRUCTOR_FROM_WITHIN_FAILURE(
-        graph_change_notifier->~IceoryxGraphChangeNotifier(), IceoryxGraphChangeNotifier)
-      rmw_free(graph_change_notifier);
-    }
     if (guard_condition) {
+      if (graph_change_notifier) {
+        graph_change_notifier->detach(guard_condition);
+      }
       if (RMW_RET_OK != rmw_destroy_guard_condition(guard_condition)) {
         RMW_SET_ERROR_MSG("failed to delete graph guard condition");
       }
@@ -156,11 +153,7 @@ rmw_destroy_node(rmw_node_t * node)
   IceoryxNodeInfo * node_info = static_cast<IceoryxNodeInfo *>(node->data);
   if (node_info) {
     if (node_info->graph_change_notifier_) {
-      RMW_TRY_DESTRUCTOR(
-        node_info->graph_change_notifier_->~IceoryxGraphChangeNotifier(),
-        node_info->graph_change_notifier_,
-        result = RMW_RET_ERROR)
-      rmw_free(node_info->graph_change_notifier_);
+      node_info->graph_change_notifier_->detach(node_info->guard_condition_);
     }
     if (RMW_RET_OK != rmw_destroy_guard_condition(node_info->guard_condition_)) {
       RMW_SET_ERROR_MSG("failed to delete graph guard condition");
@@ -21,6 +21,7 @@
 #include "rmw/get_node_info_and_types.h"
 #include "rmw/names_and_types.h"
 
+#include "rmw_iceoryx_cpp/iceoryx_service_discovery.hpp"
 #include "rmw_iceoryx_cpp/iceoryx_topic_names_and_types.hpp"
 
 extern "C"
@@ -105,9 +106,21 @@ rmw_get_service_names_and_types_by_node(
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(node_namespace, RMW_RET_ERROR);
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(service_names_and_types, RMW_RET_ERROR);
 
-  /// @todo poehnl: implementation
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    rmw_get_service_names_and_types_by_node
+    : node, node->implementation_identifier,
+    rmw_get_implementation_identifier(), return RMW_RET_ERROR);
 
-  return RMW_RET_OK;
+  rmw_ret_t rmw_ret = rmw_names_and_types_check_zero(service_names_and_types);
+  if (rmw_ret != RMW_RET_OK) {
+    return rmw_ret;
+  }
+
+  auto iceoryx_service_names_and_types = rmw_iceoryx_cpp::get_service_names_and_types_of_node(
+    rmw_iceoryx_cpp::ServiceEndpointKind::SERVER, node_name, node_namespace);
+
+  return rmw_iceoryx_cpp::fill_rmw_names_and_types(
+    service_names_and_types, iceoryx_service_names_and_types, allocator);
 }
 
 rmw_ret_t
@@ -124,8 +137,20 @@ rmw_get_client_names_and_types_by_node(
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(node_namespace, RMW_RET_ERROR);
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(service_names_and_types, RMW_RET_ERROR);
 
-  /// @todo poehnl: implementation
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    rmw_get_client_names_and_types_by_node
+    : node, node->implementation_identifier,
+    rmw_get_implementation_identifier(), return RMW_RET_ERROR);
 
-  return RMW_RET_OK;
+  rmw_ret_t rmw_ret = rmw_names_and_types_check_zero(service_names_and_types);
+  if (rmw_ret != RMW_RET_OK) {
+    return rmw_ret;
+  }
+
+  auto iceoryx_service_names_and_types = rmw_iceoryx_cpp::get_service_names_and_types_of_node(
+    rmw_iceoryx_cpp::ServiceEndpointKind::CLIENT, node_name, node_namespace);
+
+  return rmw_iceoryx_cpp::fill_rmw_names_and_types(
+    service_names_and_types, iceoryx_service_names_and_types, allocator);
 }
 }  // extern "C"
@@ -13,8 +13,6 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <vector>
-
 #include "iceoryx_posh/popo/untyped_publisher.hpp"
 
 #include "rcutils/error_handling.h"
@@ -32,14 +30,55 @@
 #include "rosidl_typesupport_introspection_cpp/message_introspection.hpp"
 
 #include "./types/iceoryx_publisher.hpp"
+#include "./types/iceoryx_user_header.hpp"
 
 extern "C"
 {
 namespace details
 {
+/// @brief Loans a chunk which has room for the IceoryxUserHeader in front of the payload
+iox::cxx::expected<void *, iox::popo::AllocationError>
+loan_chunk(iox::popo::UntypedPublisher * iceoryx_sender, uint32_t size)
+{
+  return iceoryx_sender->loan(
+    size, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+    sizeof(IceoryxUserHeader), alignof(IceoryxUserHeader));
+}
+
+/// @brief Stamps the publish time and the expiry time into the user header of the chunk. The
+///        clock is only read if the QoS of the publisher needs it, the timestamps stay 0 otherwise
+void stamp_chunk(IceoryxPublisher * iceoryx_publisher, void * user_payload)
+{
+  auto user_header = init_iceoryx_user_header(user_payload);
+  if (!iceoryx_publisher->reads_clock_) {
+    return;
+  }
+
+  rcutils_time_point_value_t now{0};
+  rcutils_system_time_now(&now);
+
+  user_header->source_timestamp_ = now;
+  user_header->expiry_timestamp_ =
+    (iceoryx_publisher->lifespan_ > 0) ? now + iceoryx_publisher->lifespan_ : 0;
+
+  iceoryx_publisher->deadline_.notify(now);
+}
+
+/// @brief A publish call without subscribers still records the time of the activity, the offered
+///        deadline and the MANUAL_BY_TOPIC liveliness of the publisher are both judged by it
+void skip_publish(IceoryxPublisher * iceoryx_publisher)
+{
+  iceoryx_publisher->skipped_publish_count_.fetch_add(1U, std::memory_order_relaxed);
+  if (iceoryx_publisher->deadline_.is_enabled() || iceoryx_publisher->liveliness_.is_enabled()) {
+    rcutils_time_point_value_t now{0};
+    rcutils_system_time_now(&now);
+    iceoryx_publisher->deadline_.notify(now);
+  }
+}
+
 rmw_ret_t
 send_payload(
-  iox::popo::UntypedPublisher * iceoryx_publisher,
+  IceoryxPublisher * iceoryx_publisher,
   const void * serialized_ros_msg,
   size_t size)
 {
@@ -47,12 +86,14 @@ send_payload(
     RMW_SET_ERROR_MSG("serialized message pointer is null");
     return RMW_RET_ERROR;
   }
+  auto iceoryx_sender = iceoryx_publisher->iceoryx_sender_;
   rmw_ret_t ret = RMW_RET_ERROR;
-  iceoryx_publisher->loan(size)
+  loan_chunk(iceoryx_sender, static_cast<uint32_t>(size))
   .and_then(
     [&](void * userPayload) {
       memcpy(userPayload, serialized_ros_msg, size);
-      iceoryx_publisher->publish(userPayload);
+      stamp_chunk(iceoryx_publisher, userPayload);
+      iceoryx_sender->publish(userPayload);
       ret = RMW_RET_OK;
     })
   .or_else(
@@ -91,9 +132,16 @@ rmw_publish(
     return RMW_RET_ERROR;
   }
 
+  // nobody is listening, so neither serialize nor loan a chunk; unless the publisher keeps a
+  // history for late-joining subscriptions nothing is lost
+  if (!iceoryx_publisher->has_history_ && !iceoryx_sender->hasSubscribers()) {
+    details::skip_publish(iceoryx_publisher);
+    return RMW_RET_OK;
+  }
+
   // if messages have a fixed size, we can just memcpy
   if (iceoryx_publisher->is_fixed_size_) {
-    return details::send_payload(iceoryx_sender, ros_message, iceoryx_publisher->message_size_);
+    return details::send_payload(iceoryx_publisher, ros_message, iceoryx_publisher->message_size_);
   }
 
   // this should never happen if checked already at rmw_create_publisher
@@ -102,13 +150,35 @@ rmw_publish(
     return RMW_RET_ERROR;
   }
 
-  // message is neither loaned nor fixed size, so we have to serialize
-  std::vector<char> payload_vector{};
+  // message is neither loaned nor fixed size, so we serialize right into a chunk of the exact
+  // serialized size
+  auto serialized_size =
+    rmw_iceoryx_cpp::get_serialized_size(ros_message, &iceoryx_publisher->type_supports_);
 
-  rmw_iceoryx_cpp::serialize(ros_message, &iceoryx_publisher->type_supports_, payload_vector);
-
-  // send composed payload
-  return details::send_payload(iceoryx_sender, payload_vector.data(), payload_vector.size());
+  rmw_ret_t ret = RMW_RET_ERROR;
+  details::loan_chunk(iceoryx_sender, static_cast<uint32_t>(serialized_size))
+  .and_then(
+    [&](void * userPayload) {
+      ret = rmw_iceoryx_cpp::try_serialize(
+        [&]() {
+          rmw_iceoryx_cpp::serialize(
+            ros_message, &iceoryx_publisher->type_supports_,
+            static_cast<char *>(userPayload), serialized_size);
+        },
+        [&]() {iceoryx_sender->release(userPayload);});
+      if (RMW_RET_OK != ret) {
+        return;
+      }
+      details::stamp_chunk(iceoryx_publisher, userPayload);
+      iceoryx_sender->publish(userPayload);
+      ret = RMW_RET_OK;
+    })
+  .or_else(
+    [&](iox::popo::AllocationError) {
+      RMW_SET_ERROR_MSG("rmw_publish error!");
+      ret = RMW_RET_ERROR;
+    });
+  return ret;
 }
 
 rmw_ret_t
@@ -138,9 +208,14 @@ rmw_publish_serialized_message(
     return RMW_RET_ERROR;
   }
 
+  if (!iceoryx_publisher->has_history_ && !iceoryx_sender->hasSubscribers()) {
+    details::skip_publish(iceoryx_publisher);
+    return RMW_RET_OK;
+  }
+
   // message is serialized, therefore necessarily fixed size
   return details::send_payload(
-    iceoryx_sender, serialized_message->buffer, serialized_message->buffer_length);
+    iceoryx_publisher, serialized_message->buffer, serialized_message->buffer_length);
 }
 
 rmw_ret_t
@@ -176,7 +251,7 @@ rmw_borrow_loaned_message(
   }
 
   rmw_ret_t ret = RMW_RET_ERROR;
-  iceoryx_sender->loan(iceoryx_publisher->message_size_)
+  details::loan_chunk(iceoryx_sender, static_cast<uint32_t>(iceoryx_publisher->message_size_))
   .and_then(
     [&](void * msg_memory) {
       rmw_iceoryx_cpp::iceoryx_init_message(&iceoryx_publisher->type_supports_, msg_memory);
@@ -257,6 +332,7 @@ rmw_publish_loaned_message(
     RMW_SET_ERROR_MSG("iceoryx can't loan non-fixed sized messages");
     return RMW_RET_ERROR;
   }
+  details::stamp_chunk(iceoryx_publisher, ros_message);
   iceoryx_sender->publish(ros_message);
   return RMW_RET_OK;
 }
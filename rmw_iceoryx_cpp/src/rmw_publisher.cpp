@@ -22,7 +22,9 @@
 #include "rmw/allocators.h"
 #include "rmw/impl/cpp/macros.hpp"
 
+#include "rmw_iceoryx_cpp/iceoryx_get_topic_endpoint_info.hpp"
 #include "rmw_iceoryx_cpp/iceoryx_name_conversion.hpp"
+#include "rmw_iceoryx_cpp/iceoryx_qos.hpp"
 
 #include "./types/iceoryx_publisher.hpp"
 
@@ -97,8 +99,7 @@ rmw_create_publisher(
   RMW_TRY_PLACEMENT_NEW(
     iceoryx_sender, iceoryx_sender,
     goto fail, iox::popo::UntypedPublisher, service_description,
-    iox::popo::PublisherOptions{
-      0U, iox::NodeName_t(iox::cxx::TruncateToCapacity, node_full_name)});
+    rmw_iceoryx_cpp::get_iceoryx_publisher_options(*qos_policies, node_full_name));
 
   iceoryx_sender->offer();  // make the sender visible
 
@@ -111,7 +112,7 @@ rmw_create_publisher(
   }
   RMW_TRY_PLACEMENT_NEW(
     iceoryx_publisher, iceoryx_publisher,
-    goto fail, IceoryxPublisher, type_supports, iceoryx_sender);
+    goto fail, IceoryxPublisher, type_supports, iceoryx_sender, qos_policies);
 
   // compose rmw_publisher
   rmw_publisher->implementation_identifier = rmw_get_implementation_identifier();
@@ -125,6 +126,15 @@ rmw_create_publisher(
   memcpy(const_cast<char *>(rmw_publisher->topic_name), topic_name, strlen(topic_name) + 1);
   rmw_publisher->can_loan_messages = iceoryx_publisher->is_fixed_size_;
 
+  {
+    // the endpoint info queries report the actual QoS of the publishers of this process
+    rmw_qos_profile_t actual_qos;
+    if (RMW_RET_OK == rmw_publisher_get_actual_qos(rmw_publisher, &actual_qos)) {
+      rmw_iceoryx_cpp::register_publisher_qos(
+        static_cast<iox::popo::UniquePortId::value_type>(iceoryx_sender->getUid()), actual_qos);
+    }
+  }
+
   return rmw_publisher;
 
 fail:
@@ -153,8 +163,28 @@ rmw_publisher_assert_liveliness(const rmw_publisher_t * publisher)
 {
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(publisher, RMW_RET_ERROR);
 
-  RMW_SET_ERROR_MSG("rmw_iceoryx_cpp does not support liveliness.");
-  return RMW_RET_UNSUPPORTED;
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    rmw_publisher_assert_liveliness
+    : publisher, publisher->implementation_identifier,
+    rmw_get_implementation_identifier(), return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+
+  auto iceoryx_publisher = static_cast<IceoryxPublisher *>(publisher->data);
+  if (!iceoryx_publisher) {
+    RMW_SET_ERROR_MSG("publisher data is null");
+    return RMW_RET_ERROR;
+  }
+
+  // AUTOMATIC liveliness is asserted by the process heartbeat which RouDi monitors
+  if (iceoryx_publisher->liveliness_.is_enabled()) {
+    rcutils_time_point_value_t now{0};
+    if (RCUTILS_RET_OK != rcutils_system_time_now(&now)) {
+      RMW_SET_ERROR_MSG("failed to get the current time");
+      return RMW_RET_ERROR;
+    }
+    iceoryx_publisher->liveliness_.assert_liveliness(now);
+  }
+
+  return RMW_RET_OK;
 }
 
 rmw_ret_t
@@ -173,10 +203,24 @@ rmw_publisher_get_actual_qos(const rmw_publisher_t * publisher, rmw_qos_profile_
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(publisher, RMW_RET_ERROR);
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(qos, RMW_RET_ERROR);
 
-  (void)publisher;
+  auto iceoryx_publisher = static_cast<IceoryxPublisher *>(publisher->data);
+  if (!iceoryx_publisher) {
+    RMW_SET_ERROR_MSG("publisher data is null");
+    return RMW_RET_ERROR;
+  }
 
   /// @todo poehnl: check in detail
   *qos = rmw_qos_profile_default;
+  // history, reliability and durability are mapped to the iceoryx options
+  qos->history = iceoryx_publisher->qos_.history;
+  qos->depth = iceoryx_publisher->qos_.depth;
+  qos->reliability = iceoryx_publisher->qos_.reliability;
+  qos->durability = iceoryx_publisher->qos_.durability;
+  // deadline and lifespan are enforced by rmw_iceoryx_cpp itself
+  qos->deadline = iceoryx_publisher->qos_.deadline;
+  qos->lifespan = iceoryx_publisher->qos_.lifespan;
+  qos->liveliness = iceoryx_publisher->qos_.liveliness;
+  qos->liveliness_lease_duration = iceoryx_publisher->qos_.liveliness_lease_duration;
 
   return RMW_RET_OK;
 }
@@ -197,6 +241,9 @@ rmw_destroy_publisher(rmw_node_t * node, rmw_publisher_t * publisher)
   IceoryxPublisher * iceoryx_publisher = static_cast<IceoryxPublisher *>(publisher->data);
   if (iceoryx_publisher) {
     if (iceoryx_publisher->iceoryx_sender_) {
+      rmw_iceoryx_cpp::unregister_publisher_qos(
+        static_cast<iox::popo::UniquePortId::value_type>(
+          iceoryx_publisher->iceoryx_sender_->getUid()));
       RMW_TRY_DESTRUCTOR(
         iceoryx_publisher->iceoryx_sender_->~UntypedPublisher(),
         iceoryx_publisher->iceoryx_sender_,
@@ -12,10 +12,16 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cstring>
+#include <string>
+
 #include "rmw/qos_profiles.h"
 #include "rcutils/error_handling.h"
 #include "rmw/impl/cpp/macros.hpp"
 
+#include "rmw_iceoryx_cpp/iceoryx_qos.hpp"
+
 extern "C"
 {
 rmw_ret_t
@@ -27,15 +33,21 @@ rmw_qos_profile_check_compatible(
   size_t reason_size)
 {
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(compatibility, RMW_RET_INVALID_ARGUMENT);
-  RCUTILS_CHECK_ARGUMENT_FOR_NULL(reason, RMW_RET_INVALID_ARGUMENT);
-  (void)publisher_profile;
-  (void)subscription_profile;
-  (void)reason_size;
+  if (!reason && reason_size != 0u) {
+    RMW_SET_ERROR_MSG("reason parameter is null, but reason_size parameter is not zero");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  std::string reason_text;
+  *compatibility = rmw_iceoryx_cpp::check_qos_compatibility(
+    publisher_profile, subscription_profile, reason_text);
 
-  // As iceoryx does not consider QoS for matching, always set ok
-  *compatibility = RMW_QOS_COMPATIBILITY_OK;
   // Un-terminated char array leads to crashes in rqt_graph
-  reason[0] = '\0';
+  if (reason_size > 0u) {
+    auto length = std::min(reason_text.size(), reason_size - 1u);
+    memcpy(reason, reason_text.c_str(), length);
+    reason[length] = '\0';
+  }
   return RMW_RET_OK;
 }
 }  // extern "C"
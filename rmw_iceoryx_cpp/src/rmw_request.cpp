@@ -14,6 +14,7 @@
 // limitations under the License.
 
 #include "rcutils/error_handling.h"
+#include "rcutils/logging_macros.h"
 
 #include "rmw/impl/cpp/macros.hpp"
 #include "rmw/rmw.h"
@@ -23,6 +24,158 @@
 
 #include "rmw_iceoryx_cpp/iceoryx_serialize.hpp"
 #include "rmw_iceoryx_cpp/iceoryx_deserialize.hpp"
+#include "rmw_iceoryx_cpp/iceoryx_service_extensions.hpp"
+
+namespace details
+{
+/// @brief Assigns the next sequence number to a loaned request and sends it. The loan ends
+///        whether sending succeeds or not.
+rmw_ret_t
+send_request(
+  IceoryxClient * iceoryx_client_abstraction,
+  void * request_payload,
+  int64_t * sequence_id)
+{
+  auto iceoryx_client = iceoryx_client_abstraction->iceoryx_client_;
+  auto request_header = iox::popo::RequestHeader::fromPayload(request_payload);
+
+  auto next_sequence_id =
+    iceoryx_client_abstraction->sequence_id_.fetch_add(1, std::memory_order_relaxed);
+  request_header->setSequenceId(next_sequence_id);
+  *sequence_id = next_sequence_id;
+
+  rmw_ret_t ret = RMW_RET_ERROR;
+  // the response might be taken before 'send' returns, hence mark the request as in flight
+  iceoryx_client_abstraction->requests_in_flight_.insert(next_sequence_id);
+  iceoryx_client->send(request_payload).and_then(
+    [&] {
+      ret = RMW_RET_OK;
+    }).or_else(
+    [&](auto &) {
+      iceoryx_client_abstraction->requests_in_flight_.remove(next_sequence_id);
+      RMW_SET_ERROR_MSG("rmw_send_request error!");
+      ret = RMW_RET_ERROR;
+    });
+  return ret;
+}
+
+/// @brief Releases held requests whose response is overdue and, if eviction is enabled and
+///        still all places are taken, the oldest held request so that a new request can be taken.
+///        Loaned requests are never released. A response sent for a released request fails like
+///        one for an unknown request.
+void reclaim_held_requests(IceoryxServer * iceoryx_server_abstraction)
+{
+  auto iceoryx_server = iceoryx_server_abstraction->iceoryx_server_;
+  auto & held_requests = iceoryx_server_abstraction->held_requests_;
+  auto release = [&](const void * request_payload) {
+      iceoryx_server->releaseRequest(request_payload);
+    };
+
+  uint64_t reclaimed{0U};
+  auto request_hold_timeout =
+    iceoryx_server_abstraction->request_hold_timeout_.load(std::memory_order_relaxed);
+  if (request_hold_timeout > 0 && !held_requests.empty()) {
+    rcutils_time_point_value_t now{0};
+    rcutils_steady_time_now(&now);
+    reclaimed += held_requests.remove_taken_before(now - request_hold_timeout, release);
+  }
+  if (iceoryx_server_abstraction->evict_held_requests_.load(std::memory_order_relaxed) &&
+    held_requests.full())
+  {
+    reclaimed += held_requests.remove_oldest(release);
+  }
+  if (reclaimed > 0U) {
+    iceoryx_server_abstraction->reclaimed_request_count_.fetch_add(
+      reclaimed, std::memory_order_relaxed);
+  }
+}
+
+/// @brief Fills the request header of a taken request and holds the request until the response
+///        is sent. The request is released if it can't be held.
+/// @param[in] loaned true if the request is handed out to the user as it is
+rmw_ret_t
+hold_request(
+  IceoryxServer * iceoryx_server_abstraction,
+  const void * iceoryx_request_payload,
+  rmw_service_info_t * request_header,
+  bool loaned = false)
+{
+  auto iceoryx_server = iceoryx_server_abstraction->iceoryx_server_;
+  const auto * chunk_header = iox::mepoo::ChunkHeader::fromUserPayload(iceoryx_request_payload);
+  const auto * iceoryx_request_header =
+    iox::popo::RequestHeader::fromPayload(iceoryx_request_payload);
+
+  request_header->source_timestamp = 0;  // Unsupported until needed
+  rmw_ret_t ret = rcutils_system_time_now(&request_header->received_timestamp);
+  if (ret != RMW_RET_OK) {
+    iceoryx_server->releaseRequest(iceoryx_request_payload);
+    return ret;
+  }
+  request_header->request_id.sequence_number = iceoryx_request_header->getSequenceId();
+  // the id of the client port tells requests of different clients with the same sequence
+  // number apart when the response is sent
+  auto typed_guid = chunk_header->originId();
+  iox::popo::UniquePortId::value_type guid =
+    static_cast<iox::popo::UniquePortId::value_type>(typed_guid);
+  size_t size = sizeof(guid);
+  auto max_rmw_storage = sizeof(request_header->request_id.writer_guid);
+  if (!typed_guid.isValid() || size > max_rmw_storage) {
+    RMW_SET_ERROR_MSG("Could not write client guid");
+    iceoryx_server->releaseRequest(iceoryx_request_payload);
+    return RMW_RET_ERROR;
+  }
+  memset(request_header->request_id.writer_guid, 0, max_rmw_storage);
+  memcpy(request_header->request_id.writer_guid, &guid, size);
+
+  rcutils_time_point_value_t taken_at{0};
+  rcutils_steady_time_now(&taken_at);
+
+  // Hold the loaned request till we send the response in 'rmw_send_response'
+  if (!iceoryx_server_abstraction->held_requests_.insert(
+      guid, request_header->request_id.sequence_number, iceoryx_request_payload, taken_at,
+      loaned))
+  {
+    RMW_SET_ERROR_MSG("rmw_take_request: Could not hold the request!");
+    iceoryx_server->releaseRequest(iceoryx_request_payload);
+    return RMW_RET_ERROR;
+  }
+  return RMW_RET_OK;
+}
+
+/// @brief Reclaims held requests and checks that another one can be held
+/// @return false if all places are taken, the next request is left in the queue then; this is
+///         no error as the request can be taken once a response is sent
+bool make_room_for_request(IceoryxServer * iceoryx_server_abstraction)
+{
+  reclaim_held_requests(iceoryx_server_abstraction);
+  if (iceoryx_server_abstraction->held_requests_.full()) {
+    RCUTILS_LOG_WARN_THROTTLE_NAMED(
+      RCUTILS_STEADY_TIME, 1000, "rmw_iceoryx_cpp",
+      "Too many requests are held without a response being sent, no further request is taken");
+    return false;
+  }
+  return true;
+}
+
+/// @brief Copies or deserializes a taken request into the user provided request
+void read_request(
+  IceoryxServer * iceoryx_server_abstraction,
+  const void * iceoryx_request_payload,
+  void * ros_request)
+{
+  // if fixed size, we fetch the data via memcpy
+  if (iceoryx_server_abstraction->is_fixed_size_) {
+    memcpy(
+      ros_request, iceoryx_request_payload,
+      iox::mepoo::ChunkHeader::fromUserPayload(iceoryx_request_payload)->userPayloadSize());
+  } else {
+    rmw_iceoryx_cpp::deserializeRequest(
+      static_cast<const char *>(iceoryx_request_payload),
+      &iceoryx_server_abstraction->type_supports_,
+      ros_request);
+  }
+}
+}  // namespace details
 
 extern "C"
 {
@@ -59,35 +212,32 @@ rmw_send_request(
     return ret;
   }
 
+  // non fixed size requests are serialized right into a chunk of the exact serialized size
+  auto payload_size = iceoryx_client_abstraction->is_fixed_size_ ?
+    iceoryx_client_abstraction->request_size_ :
+    rmw_iceoryx_cpp::get_serialized_request_size(
+    ros_request, &iceoryx_client_abstraction->type_supports_);
+
   iceoryx_client->loan(
-    iceoryx_client_abstraction->request_size_,
+    static_cast<uint32_t>(payload_size),
     iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
   .and_then(
     [&](void * requestPayload) {
-      auto requestHeader = iox::popo::RequestHeader::fromPayload(requestPayload);
-
-      requestHeader->setSequenceId(iceoryx_client_abstraction->sequence_id_);
-      *sequence_id = iceoryx_client_abstraction->sequence_id_;
-      iceoryx_client_abstraction->sequence_id_ += 1;
-
       if (iceoryx_client_abstraction->is_fixed_size_) {
-        memcpy(requestPayload, ros_request, iceoryx_client_abstraction->request_size_);
+        memcpy(requestPayload, ros_request, payload_size);
       } else {
-        // message is not fixed size, so we have to serialize
-        std::vector<char> payload_vector{};
-        rmw_iceoryx_cpp::serializeRequest(
-          ros_request, &iceoryx_client_abstraction->type_supports_,
-          payload_vector);
-        memcpy(requestPayload, payload_vector.data(), payload_vector.size());
+        ret = rmw_iceoryx_cpp::try_serialize(
+          [&]() {
+            rmw_iceoryx_cpp::serializeRequest(
+              ros_request, &iceoryx_client_abstraction->type_supports_,
+              static_cast<char *>(requestPayload), payload_size);
+          },
+          [&]() {iceoryx_client->releaseRequest(requestPayload);});
+        if (RMW_RET_OK != ret) {
+          return;
+        }
       }
-      iceoryx_client->send(requestPayload).and_then(
-        [&] {
-          ret = RMW_RET_OK;
-        }).or_else(
-        [&](auto &) {
-          RMW_SET_ERROR_MSG("rmw_send_request error!");
-          ret = RMW_RET_ERROR;
-        });
+      ret = details::send_request(iceoryx_client_abstraction, requestPayload, sequence_id);
     })
   .or_else(
     [&](auto &) {
@@ -136,67 +286,283 @@ rmw_take_request(
 
   rmw_ret_t ret = RMW_RET_ERROR;
 
+  if (!details::make_room_for_request(iceoryx_server_abstraction)) {
+    *taken = false;
+    return RMW_RET_OK;
+  }
   iceoryx_server->take()
   .and_then(
     [&](const void * iceoryx_request_payload) {
-      const auto * chunk_header =
-      iox::mepoo::ChunkHeader::fromUserPayload(
-        iceoryx_request_payload);
-      const auto * iceoryx_request_header =
-      iox::popo::RequestHeader::fromPayload(
-        iceoryx_request_payload);
-
-      request_header->source_timestamp = 0;  // Unsupported until needed
-      ret = rcutils_system_time_now(&request_header->received_timestamp);
+      ret = details::hold_request(
+        iceoryx_server_abstraction, iceoryx_request_payload, request_header);
       if (ret != RMW_RET_OK) {
+        *taken = false;
         return;
       }
-      request_header->request_id.sequence_number = iceoryx_request_header->getSequenceId();
-      auto typed_guid = iceoryx_server->getUid();
-      iox::popo::UniquePortId::value_type guid =
-      static_cast<iox::popo::UniquePortId::value_type>(typed_guid);
-      size_t size = sizeof(guid);
-      auto max_rmw_storage = sizeof(request_header->request_id.writer_guid);
-      if (!typed_guid.isValid() || size > max_rmw_storage) {
-        RMW_SET_ERROR_MSG("Could not write server guid");
-        ret = RMW_RET_ERROR;
+
+      details::read_request(iceoryx_server_abstraction, iceoryx_request_payload, ros_request);
+
+      *taken = true;
+      ret = RMW_RET_OK;
+    })
+  .or_else(
+    [&](iox::popo::ServerRequestResult result) {
+      *taken = false;
+      if (iox::popo::ServerRequestResult::NO_PENDING_REQUESTS == result) {
+        ret = RMW_RET_OK;
         return;
       }
-      memcpy(request_header->request_id.writer_guid, &guid, size);
+      RMW_SET_ERROR_MSG("rmw_take_request: Taking the sample failed!");
+      ret = RMW_RET_ERROR;
+    });
 
-      // if fixed size, we fetch the data via memcpy
-      if (iceoryx_server_abstraction->is_fixed_size_) {
-        memcpy(ros_request, iceoryx_request_payload, chunk_header->userPayloadSize());
-      } else {
-        rmw_iceoryx_cpp::deserializeRequest(
-          static_cast<const char *>(iceoryx_request_payload),
-          &iceoryx_server_abstraction->type_supports_,
-          ros_request);
-      }
+  return ret;
+}
+}  // extern "C"
+
+namespace rmw_iceoryx_cpp
+{
+rmw_ret_t
+borrow_loaned_request(const rmw_client_t * client, void ** ros_request)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(client, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(ros_request, RMW_RET_INVALID_ARGUMENT);
 
-      // Hold the loaned request till we send the response in 'rmw_send_response'
-      auto result =
-      iceoryx_server_abstraction->request_payload_map_.insert(
-        {request_header->request_id.
-          sequence_number, iceoryx_request_payload});
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    borrow_loaned_request
+    : client, client->implementation_identifier,
+    rmw_get_implementation_identifier(), return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
 
-      if (result.second == false) {
-        *taken = false;
-        RMW_SET_ERROR_MSG("rmw_take_request: Could not store the sample pointer in the map!");
-        ret = RMW_RET_ERROR;
-        return;
-      }
+  auto iceoryx_client_abstraction = static_cast<IceoryxClient *>(client->data);
+  if (!iceoryx_client_abstraction || !iceoryx_client_abstraction->iceoryx_client_) {
+    RMW_SET_ERROR_MSG("client data is null");
+    return RMW_RET_ERROR;
+  }
 
-      *taken = true;
+  if (!iceoryx_client_abstraction->is_fixed_size_) {
+    RMW_SET_ERROR_MSG("iceoryx can't loan non-fixed sized requests");
+    return RMW_RET_UNSUPPORTED;
+  }
+
+  rmw_ret_t ret = RMW_RET_ERROR;
+  iceoryx_client_abstraction->iceoryx_client_->loan(
+    static_cast<uint32_t>(iceoryx_client_abstraction->request_size_),
+    iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
+  .and_then(
+    [&](void * requestPayload) {
+      rmw_iceoryx_cpp::iceoryx_init_request(
+        &iceoryx_client_abstraction->type_supports_, requestPayload);
+      *ros_request = requestPayload;
       ret = RMW_RET_OK;
     })
   .or_else(
     [&](auto &) {
-      *taken = false;
-      RMW_SET_ERROR_MSG("rmw_take_request: Taking the sample failed!");
+      RMW_SET_ERROR_MSG("borrow_loaned_request error!");
+      ret = RMW_RET_BAD_ALLOC;
+    });
+  return ret;
+}
+
+rmw_ret_t
+return_loaned_request(const rmw_client_t * client, void * ros_request)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(client, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(ros_request, RMW_RET_INVALID_ARGUMENT);
+
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    return_loaned_request
+    : client, client->implementation_identifier,
+    rmw_get_implementation_identifier(), return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+
+  auto iceoryx_client_abstraction = static_cast<IceoryxClient *>(client->data);
+  if (!iceoryx_client_abstraction || !iceoryx_client_abstraction->iceoryx_client_) {
+    RMW_SET_ERROR_MSG("client data is null");
+    return RMW_RET_ERROR;
+  }
+
+  iceoryx_client_abstraction->iceoryx_client_->releaseRequest(ros_request);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+send_loaned_request(const rmw_client_t * client, void * ros_request, int64_t * sequence_id)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(client, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(ros_request, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(sequence_id, RMW_RET_INVALID_ARGUMENT);
+
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    send_loaned_request
+    : client, client->implementation_identifier,
+    rmw_get_implementation_identifier(), return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+
+  auto iceoryx_client_abstraction = static_cast<IceoryxClient *>(client->data);
+  if (!iceoryx_client_abstraction || !iceoryx_client_abstraction->iceoryx_client_) {
+    RMW_SET_ERROR_MSG("client data is null");
+    return RMW_RET_ERROR;
+  }
+
+  return details::send_request(iceoryx_client_abstraction, ros_request, sequence_id);
+}
+
+rmw_ret_t
+take_loaned_request(
+  const rmw_service_t * service,
+  rmw_service_info_t * request_header,
+  const void ** ros_request,
+  bool * taken)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(service, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(request_header, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(ros_request, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(taken, RMW_RET_INVALID_ARGUMENT);
+
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    take_loaned_request
+    : service, service->implementation_identifier,
+    rmw_get_implementation_identifier(), return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+
+  auto iceoryx_server_abstraction = static_cast<IceoryxServer *>(service->data);
+  if (!iceoryx_server_abstraction || !iceoryx_server_abstraction->iceoryx_server_) {
+    RMW_SET_ERROR_MSG("service data is null");
+    return RMW_RET_ERROR;
+  }
+
+  if (!iceoryx_server_abstraction->is_fixed_size_) {
+    RMW_SET_ERROR_MSG("iceoryx can't take loaned non-fixed size requests");
+    return RMW_RET_UNSUPPORTED;
+  }
+
+  *taken = false;
+  rmw_ret_t ret = RMW_RET_ERROR;
+
+  if (!details::make_room_for_request(iceoryx_server_abstraction)) {
+    return RMW_RET_OK;
+  }
+  iceoryx_server_abstraction->iceoryx_server_->take()
+  .and_then(
+    [&](const void * iceoryx_request_payload) {
+      // the request stays held until the response is sent, so it can be handed out as is
+      ret = details::hold_request(
+        iceoryx_server_abstraction, iceoryx_request_payload, request_header, true);
+      if (ret == RMW_RET_OK) {
+        *ros_request = iceoryx_request_payload;
+        *taken = true;
+      }
+    })
+  .or_else(
+    [&](iox::popo::ServerRequestResult result) {
+      if (iox::popo::ServerRequestResult::NO_PENDING_REQUESTS == result) {
+        ret = RMW_RET_OK;
+        return;
+      }
+      RMW_SET_ERROR_MSG("take_loaned_request: Taking the sample failed!");
       ret = RMW_RET_ERROR;
     });
 
   return ret;
 }
-}  // extern "C"
+
+rmw_ret_t
+set_held_request_reclamation(
+  const rmw_service_t * service,
+  rcutils_duration_value_t hold_timeout,
+  bool evict_oldest)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(service, RMW_RET_INVALID_ARGUMENT);
+
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    set_held_request_reclamation
+    : service, service->implementation_identifier,
+    rmw_get_implementation_identifier(), return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+
+  if (hold_timeout < 0) {
+    RMW_SET_ERROR_MSG("hold_timeout must not be negative");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  auto iceoryx_server_abstraction = static_cast<IceoryxServer *>(service->data);
+  if (!iceoryx_server_abstraction) {
+    RMW_SET_ERROR_MSG("service data is null");
+    return RMW_RET_ERROR;
+  }
+
+  iceoryx_server_abstraction->request_hold_timeout_.store(
+    hold_timeout, std::memory_order_relaxed);
+  iceoryx_server_abstraction->evict_held_requests_.store(evict_oldest, std::memory_order_relaxed);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+take_request_sequence(
+  const rmw_service_t * service,
+  size_t count,
+  rmw_message_sequence_t * request_sequence,
+  rmw_service_info_t * request_headers,
+  size_t * taken)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(service, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(request_sequence, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(request_headers, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(taken, RMW_RET_INVALID_ARGUMENT);
+
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    take_request_sequence
+    : service, service->implementation_identifier,
+    rmw_get_implementation_identifier(), return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+
+  if (count == 0U || count > request_sequence->capacity) {
+    RMW_SET_ERROR_MSG("count must be greater than zero and fit into the request sequence");
+    return RMW_RET_INVALID_ARGUMENT;
+  }
+
+  auto iceoryx_server_abstraction = static_cast<IceoryxServer *>(service->data);
+  if (!iceoryx_server_abstraction || !iceoryx_server_abstraction->iceoryx_server_) {
+    RMW_SET_ERROR_MSG("service data is null");
+    return RMW_RET_ERROR;
+  }
+  auto iceoryx_server = iceoryx_server_abstraction->iceoryx_server_;
+  auto & held_requests = iceoryx_server_abstraction->held_requests_;
+
+  // this should never happen if checked already at rmw_create_service
+  if (!rmw_iceoryx_cpp::iceoryx_is_valid_type_support(&iceoryx_server_abstraction->type_supports_))
+  {
+    RMW_SET_ERROR_MSG("Use either C typesupport or CPP typesupport");
+    return RMW_RET_ERROR;
+  }
+
+  *taken = 0U;
+  request_sequence->size = 0U;
+  rmw_ret_t ret = RMW_RET_OK;
+  bool queue_drained = false;
+
+  // reclaim only once, the requests taken by this call must not be reclaimed by itself
+  details::reclaim_held_requests(iceoryx_server_abstraction);
+  while (ret == RMW_RET_OK && !queue_drained && *taken < count && !held_requests.full()) {
+    iceoryx_server->take()
+    .and_then(
+      [&](const void * iceoryx_request_payload) {
+        ret = details::hold_request(
+          iceoryx_server_abstraction, iceoryx_request_payload, &request_headers[*taken]);
+        if (ret != RMW_RET_OK) {
+          return;
+        }
+        details::read_request(
+          iceoryx_server_abstraction, iceoryx_request_payload, request_sequence->data[*taken]);
+        ++(*taken);
+      })
+    .or_else(
+      [&](iox::popo::ServerRequestResult result) {
+        if (iox::popo::ServerRequestResult::NO_PENDING_REQUESTS == result) {
+          queue_drained = true;
+          return;
+        }
+        RMW_SET_ERROR_MSG("take_request_sequence: Taking the sample failed!");
+        ret = RMW_RET_ERROR;
+      });
+  }
+  request_sequence->size = *taken;
+
+  return ret;
+}
+}  // namespace rmw_iceoryx_cpp
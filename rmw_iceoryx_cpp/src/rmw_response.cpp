@@ -20,10 +20,30 @@
 
 #include "rmw_iceoryx_cpp/iceoryx_serialize.hpp"
 #include "rmw_iceoryx_cpp/iceoryx_deserialize.hpp"
+#include "rmw_iceoryx_cpp/iceoryx_service_extensions.hpp"
 
 #include "./types/iceoryx_client.hpp"
 #include "./types/iceoryx_server.hpp"
 
+namespace details
+{
+/// @brief Sends a loaned response. The loan ends whether sending succeeds or not.
+rmw_ret_t
+send_response(iox::popo::UntypedServer * iceoryx_server, void * response_payload)
+{
+  rmw_ret_t ret = RMW_RET_ERROR;
+  iceoryx_server->send(response_payload).and_then(
+    [&] {
+      ret = RMW_RET_OK;
+    }).or_else(
+    [&](auto &) {
+      RMW_SET_ERROR_MSG("rmw_send_response send error!");
+      ret = RMW_RET_ERROR;
+    });
+  return ret;
+}
+}  // namespace details
+
 extern "C"
 {
 rmw_ret_t
@@ -57,6 +77,7 @@ rmw_take_response(
     return RMW_RET_ERROR;
   }
 
+  *taken = false;
   rmw_ret_t ret = RMW_RET_ERROR;
 
   iceoryx_client->take()
@@ -65,29 +86,33 @@ rmw_take_response(
       auto iceoryx_response_header = iox::popo::ResponseHeader::fromPayload(
         iceoryx_response_payload);
 
-      if (iceoryx_response_header->getSequenceId() ==
-      iceoryx_client_abstraction->sequence_id_ - 1)
+      const iox::mepoo::ChunkHeader * chunk_header =
+      iox::mepoo::ChunkHeader::fromUserPayload(iceoryx_response_payload);
+
+      // a response which is rejected leaves its request in flight
+      auto typed_guid = chunk_header->originId();
+      iox::popo::UniquePortId::value_type guid =
+      static_cast<iox::popo::UniquePortId::value_type>(typed_guid);
+      size_t size = sizeof(guid);
+      auto max_rmw_storage = sizeof(request_header->request_id.writer_guid);
+      rcutils_time_point_value_t received_timestamp{0};
+      if (!typed_guid.isValid() || size > max_rmw_storage) {
+        RMW_SET_ERROR_MSG("Could not write server guid");
+        ret = RMW_RET_ERROR;
+      } else if (RCUTILS_RET_OK != rcutils_system_time_now(&received_timestamp)) {
+        RMW_SET_ERROR_MSG("failed to get the current time");
+        ret = RMW_RET_ERROR;
+      } else if (!iceoryx_client_abstraction->requests_in_flight_.remove(
+          iceoryx_response_header->getSequenceId()))
       {
-        const iox::mepoo::ChunkHeader * chunk_header =
-        iox::mepoo::ChunkHeader::fromUserPayload(iceoryx_response_payload);
-
-        auto typed_guid = chunk_header->originId();
-        iox::popo::UniquePortId::value_type guid =
-        static_cast<iox::popo::UniquePortId::value_type>(typed_guid);
-        size_t size = sizeof(guid);
-        auto max_rmw_storage = sizeof(request_header->request_id.writer_guid);
-        if (!typed_guid.isValid() || size > max_rmw_storage) {
-          RMW_SET_ERROR_MSG("Could not write server guid");
-          ret = RMW_RET_ERROR;
-          return;
-        }
+        // responses may arrive in any order, only the ones of requests in flight are accepted;
+        // the request was evicted from the window or never sent by this client, drop it
+        ret = RMW_RET_OK;
+      } else {
         memcpy(request_header->request_id.writer_guid, &guid, size);
         request_header->request_id.sequence_number = iceoryx_response_header->getSequenceId();
         request_header->source_timestamp = 0;  // Unsupported until needed
-        ret = rcutils_system_time_now(&request_header->received_timestamp);
-        if (ret != RMW_RET_OK) {
-          return;
-        }
+        request_header->received_timestamp = received_timestamp;
 
         // if fixed size, we fetch the data via memcpy
         if (iceoryx_client_abstraction->is_fixed_size_) {
@@ -101,17 +126,16 @@ rmw_take_response(
 
         *taken = true;
         ret = RMW_RET_OK;
-      } else {
-        RMW_SET_ERROR_MSG("Got response with outdated sequence number!");
-        *taken = false;
-        ret = RMW_RET_ERROR;
       }
       iceoryx_client->releaseResponse(iceoryx_response_payload);
     })
   .or_else(
-    [&](auto &) {
-      *taken = false;
-      RMW_SET_ERROR_MSG("No chunk in iceoryx_client");
+    [&](iox::popo::ChunkReceiveResult result) {
+      if (iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE == result) {
+        ret = RMW_RET_OK;
+        return;
+      }
+      RMW_SET_ERROR_MSG("Failed to take a response from iceoryx_client");
       ret = RMW_RET_ERROR;
     });
 
@@ -146,47 +170,53 @@ rmw_send_response(
   }
 
   rmw_ret_t ret = RMW_RET_ERROR;
-  auto & payload_ptr_map = iceoryx_server_abstraction->request_payload_map_;
+  auto & held_requests = iceoryx_server_abstraction->held_requests_;
 
-  if (payload_ptr_map.empty()) {
+  if (held_requests.empty()) {
     RMW_SET_ERROR_MSG("'rmw_take_request' needs to be called before 'rmw_send_response'!");
     ret = RMW_RET_ERROR;
     return ret;
   }
 
-  auto it = payload_ptr_map.find(request_header->sequence_number);
+  iox::popo::UniquePortId::value_type client_id{0U};
+  memcpy(&client_id, request_header->writer_guid, sizeof(client_id));
+  const void * request_payload =
+    held_requests.remove(client_id, request_header->sequence_number);
 
-  if (it == payload_ptr_map.end()) {
-    RMW_SET_ERROR_MSG("Could not find the payload pointer in the map");
+  if (!request_payload) {
+    RMW_SET_ERROR_MSG("Could not find the held request");
     ret = RMW_RET_ERROR;
     return ret;
   }
 
-  auto * iceoryx_request_header = iox::popo::RequestHeader::fromPayload((*it).second);
+  auto * iceoryx_request_header = iox::popo::RequestHeader::fromPayload(request_payload);
+
+  // non fixed size responses are serialized right into a chunk of the exact serialized size
+  auto payload_size = iceoryx_server_abstraction->is_fixed_size_ ?
+    iceoryx_server_abstraction->response_size_ :
+    rmw_iceoryx_cpp::get_serialized_response_size(
+    ros_response, &iceoryx_server_abstraction->type_supports_);
 
   iceoryx_server->loan(
-    iceoryx_request_header, iceoryx_server_abstraction->response_size_,
+    iceoryx_request_header, static_cast<uint32_t>(payload_size),
     iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
   .and_then(
     [&](void * responsePayload) {
       if (iceoryx_server_abstraction->is_fixed_size_) {
-        memcpy(responsePayload, ros_response, iceoryx_server_abstraction->response_size_);
+        memcpy(responsePayload, ros_response, payload_size);
       } else {
-        // message is not fixed size, so we have to serialize
-        std::vector<char> payload_vector{};
-        rmw_iceoryx_cpp::serializeResponse(
-          ros_response,
-          &iceoryx_server_abstraction->type_supports_, payload_vector);
-        memcpy(responsePayload, payload_vector.data(), payload_vector.size());
+        ret = rmw_iceoryx_cpp::try_serialize(
+          [&]() {
+            rmw_iceoryx_cpp::serializeResponse(
+              ros_response, &iceoryx_server_abstraction->type_supports_,
+              static_cast<char *>(responsePayload), payload_size);
+          },
+          [&]() {iceoryx_server->releaseResponse(responsePayload);});
+        if (RMW_RET_OK != ret) {
+          return;
+        }
       }
-      iceoryx_server->send(responsePayload).and_then(
-        [&] {
-          ret = RMW_RET_OK;
-        }).or_else(
-        [&](auto &) {
-          RMW_SET_ERROR_MSG("rmw_send_response send error!");
-          ret = RMW_RET_ERROR;
-        });
+      ret = details::send_response(iceoryx_server, responsePayload);
     })
   .or_else(
     [&](auto &) {
@@ -194,10 +224,129 @@ rmw_send_response(
       ret = RMW_RET_ERROR;
     });
 
-  // Release the hold request and delete the entry from the map
-  iceoryx_server->releaseRequest((*it).second);
-  payload_ptr_map.erase(request_header->sequence_number);
+  // Release the held request, its entry was already removed
+  iceoryx_server->releaseRequest(request_payload);
 
   return ret;
 }
 }  // extern "C"
+
+namespace rmw_iceoryx_cpp
+{
+rmw_ret_t
+borrow_loaned_response(
+  const rmw_service_t * service,
+  const rmw_request_id_t * request_header,
+  void ** ros_response)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(service, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(request_header, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(ros_response, RMW_RET_INVALID_ARGUMENT);
+
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    borrow_loaned_response
+    : service, service->implementation_identifier,
+    rmw_get_implementation_identifier(), return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+
+  auto iceoryx_server_abstraction = static_cast<IceoryxServer *>(service->data);
+  if (!iceoryx_server_abstraction || !iceoryx_server_abstraction->iceoryx_server_) {
+    RMW_SET_ERROR_MSG("service data is null");
+    return RMW_RET_ERROR;
+  }
+
+  if (!iceoryx_server_abstraction->is_fixed_size_) {
+    RMW_SET_ERROR_MSG("iceoryx can't loan non-fixed sized responses");
+    return RMW_RET_UNSUPPORTED;
+  }
+
+  // the response is routed to the client by the header of the request, which stays held
+  iox::popo::UniquePortId::value_type client_id{0U};
+  memcpy(&client_id, request_header->writer_guid, sizeof(client_id));
+  const void * request_payload =
+    iceoryx_server_abstraction->held_requests_.find(client_id, request_header->sequence_number);
+  if (!request_payload) {
+    RMW_SET_ERROR_MSG("Could not find the held request");
+    return RMW_RET_ERROR;
+  }
+
+  rmw_ret_t ret = RMW_RET_ERROR;
+  iceoryx_server_abstraction->iceoryx_server_->loan(
+    iox::popo::RequestHeader::fromPayload(request_payload),
+    static_cast<uint32_t>(iceoryx_server_abstraction->response_size_),
+    iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
+  .and_then(
+    [&](void * responsePayload) {
+      rmw_iceoryx_cpp::iceoryx_init_response(
+        &iceoryx_server_abstraction->type_supports_, responsePayload);
+      *ros_response = responsePayload;
+      ret = RMW_RET_OK;
+    })
+  .or_else(
+    [&](auto &) {
+      RMW_SET_ERROR_MSG("borrow_loaned_response error!");
+      ret = RMW_RET_BAD_ALLOC;
+    });
+  return ret;
+}
+
+rmw_ret_t
+return_loaned_response(const rmw_service_t * service, void * ros_response)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(service, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(ros_response, RMW_RET_INVALID_ARGUMENT);
+
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    return_loaned_response
+    : service, service->implementation_identifier,
+    rmw_get_implementation_identifier(), return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+
+  auto iceoryx_server_abstraction = static_cast<IceoryxServer *>(service->data);
+  if (!iceoryx_server_abstraction || !iceoryx_server_abstraction->iceoryx_server_) {
+    RMW_SET_ERROR_MSG("service data is null");
+    return RMW_RET_ERROR;
+  }
+
+  iceoryx_server_abstraction->iceoryx_server_->releaseResponse(ros_response);
+  return RMW_RET_OK;
+}
+
+rmw_ret_t
+send_loaned_response(
+  const rmw_service_t * service,
+  const rmw_request_id_t * request_header,
+  void * ros_response)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(service, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(request_header, RMW_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(ros_response, RMW_RET_INVALID_ARGUMENT);
+
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    send_loaned_response
+    : service, service->implementation_identifier,
+    rmw_get_implementation_identifier(), return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+
+  auto iceoryx_server_abstraction = static_cast<IceoryxServer *>(service->data);
+  if (!iceoryx_server_abstraction || !iceoryx_server_abstraction->iceoryx_server_) {
+    RMW_SET_ERROR_MSG("service data is null");
+    return RMW_RET_ERROR;
+  }
+  auto iceoryx_server = iceoryx_server_abstraction->iceoryx_server_;
+
+  iox::popo::UniquePortId::value_type client_id{0U};
+  memcpy(&client_id, request_header->writer_guid, sizeof(client_id));
+  const void * request_payload =
+    iceoryx_server_abstraction->held_requests_.remove(client_id, request_header->sequence_number);
+  if (!request_payload) {
+    RMW_SET_ERROR_MSG("Could not find the held request");
+    iceoryx_server->releaseResponse(ros_response);
+    return RMW_RET_ERROR;
+  }
+
+  auto ret = details::send_response(iceoryx_server, ros_response);
+
+  // Release the held request, its entry was already removed
+  iceoryx_server->releaseRequest(request_payload);
+
+  return ret;
+}
+}  // namespace rmw_iceoryx_cpp
@@ -12,8 +12,6 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <vector>
-
 #include "rcutils/error_handling.h"
 
 #include "rmw/rmw.h"
@@ -61,12 +59,24 @@ rmw_serialize(
       serialized_message, ros_message, rmw_iceoryx_cpp::iceoryx_get_message_size(type_supports));
   }
 
-  // it's no fixed size message, so we have to serialize
-  std::vector<char> payload_vector{};
-  rmw_iceoryx_cpp::serialize(ros_message, type_supports, payload_vector);
-
-  return details::copy_payload_into_serialized_message(
-    serialized_message, payload_vector.data(), payload_vector.size());
+  // it's no fixed size message, so we serialize right into the buffer of the serialized message
+  auto serialized_size = rmw_iceoryx_cpp::get_serialized_size(ros_message, type_supports);
+  rmw_ret_t ret = RMW_RET_OK;
+  if (serialized_message->buffer_capacity < serialized_size) {
+    ret = rmw_serialized_message_resize(serialized_message, serialized_size);
+  }
+  if (RMW_RET_OK == ret) {
+    ret = rmw_iceoryx_cpp::try_serialize(
+      [&]() {
+        rmw_iceoryx_cpp::serialize(
+          ros_message, type_supports,
+          reinterpret_cast<char *>(serialized_message->buffer), serialized_size);
+      });
+  }
+  if (RMW_RET_OK == ret) {
+    serialized_message->buffer_length = serialized_size;
+  }
+  return ret;
 }
 
 rmw_ret_t
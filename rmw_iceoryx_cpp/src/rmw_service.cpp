@@ -13,6 +13,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <string>
+
 #include "rcutils/error_handling.h"
 
 #include "rmw/allocators.h"
@@ -20,6 +23,7 @@
 #include "rmw/rmw.h"
 
 #include "rmw_iceoryx_cpp/iceoryx_name_conversion.hpp"
+#include "rmw_iceoryx_cpp/iceoryx_service_discovery.hpp"
 
 #include "types/iceoryx_server.hpp"
 
@@ -107,9 +111,18 @@ rmw_create_service(
     cleanupAfterError();
     return nullptr;
   }
+
+  // a server holds as many requests as its queue keeps, but iceoryx refuses to hand out more
+  // than MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY while they are held
+  uint64_t max_held_requests = iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY;
+  if (RMW_QOS_POLICY_HISTORY_KEEP_ALL != qos_policies->history) {
+    max_held_requests = std::min<uint64_t>(
+      std::max<uint64_t>(qos_policies->depth, 1U), iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY);
+  }
+
   RMW_TRY_PLACEMENT_NEW(
     iceoryx_server_abstraction, iceoryx_server_abstraction,
-    cleanupAfterError(), IceoryxServer, type_supports, iceoryx_server);
+    cleanupAfterError(), IceoryxServer, type_supports, iceoryx_server, max_held_requests);
   if (returnOnError) {
     return nullptr;
   }
@@ -126,6 +139,10 @@ rmw_create_service(
   }
   memcpy(const_cast<char *>(rmw_service->service_name), service_name, strlen(service_name) + 1);
 
+  rmw_iceoryx_cpp::register_service_endpoint(
+    rmw_iceoryx_cpp::ServiceEndpointKind::SERVER, service_description, node->name,
+    node->namespace_);
+
   return rmw_service;
 }
 
@@ -145,6 +162,10 @@ rmw_destroy_service(rmw_node_t * node, rmw_service_t * service)
   IceoryxServer * iceoryx_server_abstraction = static_cast<IceoryxServer *>(service->data);
   if (iceoryx_server_abstraction) {
     if (iceoryx_server_abstraction->iceoryx_server_) {
+      rmw_iceoryx_cpp::unregister_service_endpoint(
+        rmw_iceoryx_cpp::ServiceEndpointKind::SERVER,
+        iceoryx_server_abstraction->iceoryx_server_->getServiceDescription(),
+        node->name, node->namespace_);
       RMW_TRY_DESTRUCTOR(
         iceoryx_server_abstraction->iceoryx_server_->~UntypedServer(),
         iceoryx_server_abstraction->iceoryx_server_,
@@ -20,8 +20,11 @@
 #include "rmw/names_and_types.h"
 #include "rmw/rmw.h"
 
+#include "rmw_iceoryx_cpp/iceoryx_service_discovery.hpp"
 #include "rmw_iceoryx_cpp/iceoryx_topic_names_and_types.hpp"
 
+#include "./types/iceoryx_node.hpp"
+
 extern "C"
 {
 rmw_ret_t
@@ -44,11 +47,26 @@ rmw_get_service_names_and_types(
     return rmw_ret;  // error already set
   }
 
-  auto iceoryx_service_names_and_types = rmw_iceoryx_cpp::get_service_names_and_types();
+  auto node_info = static_cast<IceoryxNodeInfo *>(node->data);
+  if (!node_info || !node_info->service_discovery_cache_) {
+    RMW_SET_ERROR_MSG("node info is null");
+    return RMW_RET_ERROR;
+  }
 
-  return rmw_iceoryx_cpp::fill_rmw_names_and_types(
-    service_names_and_types, iceoryx_service_names_and_types, allocator);
+  // the snapshot is immutable, so it is converted without copying the cached names
+  auto service_discovery_snapshot = node_info->service_discovery_cache_->snapshot();
 
-  return RMW_RET_OK;
+  // clients are not discoverable in iceoryx, only those of this process are known
+  auto client_names_and_types = rmw_iceoryx_cpp::get_client_service_names_and_types();
+  if (client_names_and_types.empty()) {
+    return rmw_iceoryx_cpp::fill_rmw_names_and_types(
+      service_names_and_types, service_discovery_snapshot->names_n_types_, allocator);
+  }
+
+  client_names_and_types.insert(
+    service_discovery_snapshot->names_n_types_.begin(),
+    service_discovery_snapshot->names_n_types_.end());
+  return rmw_iceoryx_cpp::fill_rmw_names_and_types(
+    service_names_and_types, client_names_and_types, allocator);
 }
 }  // extern "C"
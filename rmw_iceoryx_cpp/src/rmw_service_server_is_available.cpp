@@ -18,7 +18,10 @@
 #include "rmw/impl/cpp/macros.hpp"
 #include "rmw/rmw.h"
 
+#include "rmw_iceoryx_cpp/iceoryx_service_discovery.hpp"
+
 #include "./types/iceoryx_client.hpp"
+#include "./types/iceoryx_node.hpp"
 
 extern "C"
 {
@@ -34,6 +37,13 @@ rmw_service_server_is_available(
 
   rmw_ret_t ret = RMW_RET_ERROR;
 
+  auto node_info = static_cast<IceoryxNodeInfo *>(node->data);
+  if (!node_info || !node_info->service_discovery_cache_) {
+    RMW_SET_ERROR_MSG("node info is null");
+    ret = RMW_RET_ERROR;
+    return ret;
+  }
+
   auto iceoryx_client_abstraction = static_cast<IceoryxClient *>(client->data);
   if (!iceoryx_client_abstraction) {
     RMW_SET_ERROR_MSG("client data is null");
@@ -48,7 +58,12 @@ rmw_service_server_is_available(
     return ret;
   }
 
-  *is_available = iceoryx_client->getConnectionState() == iox::ConnectionState::CONNECTED;
+  // the cache answers without touching the client port as long as no server is offered, which
+  // is what 'wait_for_service' loops poll for; the client may still be connecting afterwards
+  const auto & service_description = iceoryx_client->getServiceDescription();
+  *is_available =
+    node_info->service_discovery_cache_->is_server_offered(service_description) &&
+    iceoryx_client->getConnectionState() == iox::ConnectionState::CONNECTED;
 
   ret = RMW_RET_OK;
   return ret;
@@ -24,7 +24,9 @@
 #include "rmw/rmw.h"
 
 #include "rmw_iceoryx_cpp/iceoryx_name_conversion.hpp"
+#include "rmw_iceoryx_cpp/iceoryx_qos.hpp"
 
+#include "./types/iceoryx_node.hpp"
 #include "./types/iceoryx_subscription.hpp"
 
 extern "C"
@@ -78,6 +80,7 @@ rmw_create_subscription(
   rmw_subscription_t * rmw_subscription = nullptr;
   iox::popo::UntypedSubscriber * iceoryx_receiver = nullptr;
   IceoryxSubscription * iceoryx_subscription = nullptr;
+  IceoryxNodeInfo * node_info = nullptr;
 
   rmw_subscription = rmw_subscription_allocate();
   if (!rmw_subscription) {
@@ -95,10 +98,9 @@ rmw_create_subscription(
   RMW_TRY_PLACEMENT_NEW(
     iceoryx_receiver, iceoryx_receiver, goto fail,
     iox::popo::UntypedSubscriber, service_description,
-    iox::popo::SubscriberOptions{
-      qos_policies->depth, 0U, iox::NodeName_t(iox::cxx::TruncateToCapacity, node_full_name)});
+    rmw_iceoryx_cpp::get_iceoryx_subscriber_options(*qos_policies, node_full_name));
 
-  // instant subscribe, queue size form qos settings
+  // instant subscribe, queue size and policies from qos settings
   iceoryx_receiver->subscribe();
 
   iceoryx_subscription =
@@ -109,7 +111,7 @@ rmw_create_subscription(
   }
   RMW_TRY_PLACEMENT_NEW(
     iceoryx_subscription, iceoryx_subscription,
-    goto fail, IceoryxSubscription, type_supports, iceoryx_receiver)
+    goto fail, IceoryxSubscription, type_supports, iceoryx_receiver, qos_policies, topic_name)
 
   rmw_subscription->implementation_identifier = rmw_get_implementation_identifier();
   rmw_subscription->data = iceoryx_subscription;
@@ -123,6 +125,13 @@ rmw_create_subscription(
 
   rmw_subscription->can_loan_messages = iceoryx_subscription->is_fixed_size_;
 
+  // a graph change wakes up a wait for the liveliness changed event
+  node_info = static_cast<IceoryxNodeInfo *>(node->data);
+  if (node_info && node_info->graph_change_notifier_) {
+    node_info->graph_change_notifier_->attach(&iceoryx_subscription->graph_change_trigger_);
+    iceoryx_subscription->graph_change_notifier_ = node_info->graph_change_notifier_;
+  }
+
   return rmw_subscription;
 
 fail:
@@ -155,8 +164,23 @@ rmw_subscription_get_actual_qos(
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(subscription, RMW_RET_ERROR);
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(qos, RMW_RET_ERROR);
 
+  auto iceoryx_subscription = static_cast<IceoryxSubscription *>(subscription->data);
+  if (!iceoryx_subscription) {
+    RMW_SET_ERROR_MSG("subscription data is null");
+    return RMW_RET_ERROR;
+  }
+
   /// @todo poehnl: check in detail
   *qos = rmw_qos_profile_default;
+  // history, reliability and durability are mapped to the iceoryx options
+  qos->history = iceoryx_subscription->qos_.history;
+  qos->depth = iceoryx_subscription->qos_.depth;
+  qos->reliability = iceoryx_subscription->qos_.reliability;
+  qos->durability = iceoryx_subscription->qos_.durability;
+  // the deadline is enforced by rmw_iceoryx_cpp itself, the lifespan is taken from the publisher
+  qos->deadline = iceoryx_subscription->qos_.deadline;
+  qos->liveliness = iceoryx_subscription->qos_.liveliness;
+  qos->liveliness_lease_duration = iceoryx_subscription->qos_.liveliness_lease_duration;
 
   return RMW_RET_OK;
 }
@@ -213,6 +237,10 @@ rmw_destroy_subscription(
   IceoryxSubscription * iceoryx_subscription =
     static_cast<IceoryxSubscription *>(subscription->data);
   if (iceoryx_subscription) {
+    auto node_info = static_cast<IceoryxNodeInfo *>(node->data);
+    if (node_info && node_info->graph_change_notifier_) {
+      node_info->graph_change_notifier_->detach(&iceoryx_subscription->graph_change_trigger_);
+    }
     if (iceoryx_subscription->iceoryx_receiver_) {
       // @todo Can we avoid to use the impl here?
       RMW_TRY_DESTRUCTOR(
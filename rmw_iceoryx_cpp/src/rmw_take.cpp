@@ -13,7 +13,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "./iceoryx_qos_events.hpp"
 #include "./types/iceoryx_subscription.hpp"
+#include "./types/iceoryx_user_header.hpp"
 
 #include "iceoryx_posh/popo/untyped_subscriber.hpp"
 
@@ -35,6 +37,61 @@
 
 extern "C"
 {
+namespace details
+{
+/// @brief Takes the next chunk which did not outlive the lifespan its publisher stamped into it.
+///        Expired chunks are released right away, so no deserialization is spent on stale data.
+/// @return RMW_RET_OK and a nullptr payload if the queue holds no valid chunk
+rmw_ret_t
+take_valid_chunk(IceoryxSubscription * iceoryx_subscription, const void ** user_payload)
+{
+  auto iceoryx_receiver = iceoryx_subscription->iceoryx_receiver_;
+  rcutils_time_point_value_t now{0};
+  *user_payload = nullptr;
+
+  while (true) {
+    const void * chunk = nullptr;
+    rmw_ret_t ret = RMW_RET_OK;
+    iceoryx_receiver->take()
+    .and_then(
+      [&](const void * userPayload) {
+        chunk = userPayload;
+      })
+    .or_else(
+      [&](iox::popo::ChunkReceiveResult result) {
+        if (iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE != result) {
+          RMW_SET_ERROR_MSG("failed to take a chunk from iceoryx_receiver");
+          ret = RMW_RET_ERROR;
+        }
+      });
+    if (!chunk) {
+      return ret;
+    }
+
+    auto user_header = get_iceoryx_user_header(chunk);
+    if (user_header && user_header->expiry_timestamp_ != 0) {
+      if (now == 0) {
+        rcutils_system_time_now(&now);
+      }
+      if (now > user_header->expiry_timestamp_) {
+        iceoryx_receiver->release(chunk);
+        continue;
+      }
+    }
+
+    if (iceoryx_subscription->deadline_.is_enabled()) {
+      if (now == 0) {
+        rcutils_system_time_now(&now);
+      }
+      iceoryx_subscription->deadline_.notify(now);
+    }
+
+    *user_payload = chunk;
+    return RMW_RET_OK;
+  }
+}
+}  // namespace details
+
 rmw_ret_t
 rmw_take(
   const rmw_subscription_t * subscription,
@@ -47,6 +104,8 @@ rmw_take(
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(taken, RMW_RET_ERROR);
   (void)allocation;
 
+  *taken = false;
+
   RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
     rmw_take
     : subscription,
@@ -77,27 +136,12 @@ rmw_take(
     return RMW_RET_ERROR;
   }
 
-  const iox::mepoo::ChunkHeader * chunk_header = nullptr;
   const void * user_payload = nullptr;
-
-  rmw_ret_t ret = RMW_RET_ERROR;
-  iceoryx_receiver->take()
-  .and_then(
-    [&](const void * userPayload) {
-      user_payload = userPayload;
-      chunk_header = iox::mepoo::ChunkHeader::fromUserPayload(user_payload);
-      ret = RMW_RET_OK;
-    })
-  .or_else(
-    [&](iox::popo::ChunkReceiveResult) {
-      RMW_SET_ERROR_MSG("No chunk in iceoryx_receiver");
-      ret = RMW_RET_ERROR;
-    });
-
-  /// @todo move this to lambda in a function?
-  if (ret == RMW_RET_ERROR) {
+  rmw_ret_t ret = details::take_valid_chunk(iceoryx_subscription, &user_payload);
+  if (!user_payload) {
     return ret;
   }
+  auto chunk_header = iox::mepoo::ChunkHeader::fromUserPayload(user_payload);
 
   // if fixed size, we fetch the data via memcpy
   if (iceoryx_subscription->is_fixed_size_) {
@@ -149,6 +193,8 @@ rmw_take_serialized_message(
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(taken, RMW_RET_ERROR);
   (void)allocation;
 
+  *taken = false;
+
   RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
     rmw_take
     : subscription,
@@ -179,30 +225,21 @@ rmw_take_serialized_message(
     return RMW_RET_ERROR;
   }
 
-  const iox::mepoo::ChunkHeader * chunk_header = nullptr;
   const void * user_payload = nullptr;
-
-  rmw_ret_t ret = RMW_RET_OK;
-  iceoryx_receiver->take()
-  .and_then(
-    [&](const void * userPayload) {
-      user_payload = userPayload;
-      chunk_header = iox::mepoo::ChunkHeader::fromUserPayload(user_payload);
-    })
-  .or_else(
-    [&](iox::popo::ChunkReceiveResult) {
-      RMW_SET_ERROR_MSG("No chunk in iceoryx_receiver");
-      ret = RMW_RET_ERROR;
-    });
+  rmw_ret_t ret = details::take_valid_chunk(iceoryx_subscription, &user_payload);
+  if (!user_payload) {
+    return ret;
+  }
+  auto chunk_header = iox::mepoo::ChunkHeader::fromUserPayload(user_payload);
 
   // all incoming data is serialzed already in memory, so simply call memcopy
   ret = rmw_serialized_message_resize(serialized_message, chunk_header->userPayloadSize());
   if (RMW_RET_OK == ret) {
     memcpy(serialized_message->buffer, user_payload, chunk_header->userPayloadSize());
     serialized_message->buffer_length = chunk_header->userPayloadSize();
-    iceoryx_receiver->release(user_payload);
     *taken = true;
   }
+  iceoryx_receiver->release(user_payload);
 
   return ret;
 }
@@ -271,21 +308,14 @@ rmw_take_loaned_message(
     return RMW_RET_ERROR;
   }
 
-  rmw_ret_t ret = RMW_RET_OK;
-  iceoryx_receiver->take()
-  .and_then(
-    [&](const void * userPayload) {
-      *loaned_message = const_cast<void *>(userPayload);
-      ret = RMW_RET_OK;
-    })
-  .or_else(
-    [&](auto &) {
-      RMW_SET_ERROR_MSG("No chunk in iceoryx_receiver");
-      ret = RMW_RET_ERROR;
-    });
-  *taken = true;
+  const void * user_payload = nullptr;
+  rmw_ret_t ret = details::take_valid_chunk(iceoryx_subscription, &user_payload);
+  if (user_payload) {
+    *loaned_message = const_cast<void *>(user_payload);
+    *taken = true;
+  }
 
-  return RMW_RET_OK;
+  return ret;
 }
 
 rmw_ret_t
@@ -337,8 +367,14 @@ rmw_take_event(const rmw_event_t * event_handle, void * event_info, bool * taken
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(event_info, RMW_RET_ERROR);
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(taken, RMW_RET_ERROR);
 
-  RMW_SET_ERROR_MSG("rmw_iceoryx_cpp does not support events.");
-  return RMW_RET_UNSUPPORTED;
+  RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+    rmw_take_event
+    : event_handle,
+    event_handle->implementation_identifier,
+    rmw_get_implementation_identifier(),
+    return RMW_RET_ERROR);
+
+  return rmw_iceoryx_cpp::take_qos_event(event_handle, event_info, taken);
 }
 
 rmw_ret_t
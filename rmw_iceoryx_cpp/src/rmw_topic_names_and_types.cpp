@@ -24,6 +24,7 @@
 #include "rmw/names_and_types.h"
 #include "rmw/rmw.h"
 
+#include "rmw_iceoryx_cpp/iceoryx_graph_cache.hpp"
 #include "rmw_iceoryx_cpp/iceoryx_topic_names_and_types.hpp"
 
 extern "C"
@@ -50,9 +51,10 @@ rmw_get_topic_names_and_types(
     return rmw_ret;  // error already set
   }
 
-  auto iceoryx_topic_names_and_types = rmw_iceoryx_cpp::get_topic_names_and_types();
+  // the snapshot is immutable, so it is converted without copying the cached names
+  auto graph = rmw_iceoryx_cpp::get_graph_snapshot();
 
   return rmw_iceoryx_cpp::fill_rmw_names_and_types(
-    topic_names_and_types, iceoryx_topic_names_and_types, allocator);
+    topic_names_and_types, graph->names_n_types_, allocator);
 }
 }  // extern "C"
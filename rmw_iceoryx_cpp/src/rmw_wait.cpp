@@ -15,6 +15,8 @@
 
 #include <time.h>
 
+#include <algorithm>
+
 #include "iceoryx_posh/popo/untyped_subscriber.hpp"
 #include "iceoryx_posh/popo/wait_set.hpp"
 #include "iceoryx_posh/popo/user_trigger.hpp"
@@ -24,6 +26,7 @@
 #include "rmw/impl/cpp/macros.hpp"
 #include "rmw/rmw.h"
 
+#include "./iceoryx_qos_events.hpp"
 #include "./types/iceoryx_subscription.hpp"
 #include "./types/iceoryx_client.hpp"
 #include "./types/iceoryx_server.hpp"
@@ -110,18 +113,52 @@ rmw_wait(
       });
   }
 
+  // a liveliness changed event is woken up by graph changes, it is attached before it is
+  // evaluated so that no change in between is missed
+  for (size_t i = 0; i < events->event_count; ++i) {
+    auto event = static_cast<rmw_event_t *>(events->events[i]);
+    if (RMW_EVENT_LIVELINESS_CHANGED != event->event_type) {
+      continue;
+    }
+    auto iceoryx_subscription = static_cast<IceoryxSubscription *>(event->data);
+    waitset->attachEvent(iceoryx_subscription->graph_change_trigger_).or_else(
+      [&](auto) {
+        RMW_SET_ERROR_MSG("failed to attach liveliness changed event");
+        skip_wait = true;
+      });
+  }
+
+  // the other QoS events are not attached to the WaitSet, they are evaluated against the clock
+  // instead and the wait is shortened so that e.g. a missed deadline is reported when it expires
+  rcutils_time_point_value_t now{0};
+  rcutils_duration_value_t time_until_event_update{IceoryxDeadline::NO_UPDATE_NEEDED};
+  if (events->event_count > 0) {
+    rcutils_system_time_now(&now);
+  }
+  for (size_t i = 0; i < events->event_count; ++i) {
+    auto event = static_cast<rmw_event_t *>(events->events[i]);
+    rcutils_duration_value_t time_until_update{0};
+    if (rmw_iceoryx_cpp::update_qos_event(event, now, time_until_update)) {
+      skip_wait = true;
+    }
+    time_until_event_update = std::min(time_until_event_update, time_until_update);
+  }
+
   if (skip_wait) {
     goto after_wait;
   }
 
   // The triggered entities are checked below individually, this could be refactored by looping
   // over the vector returned by 'wait()' and using 'vectorEntry->doesOriginateFrom()'
-  if (!wait_timeout) {
+  if (!wait_timeout && time_until_event_update == IceoryxDeadline::NO_UPDATE_NEEDED) {
     waitset->wait();
   } else {
-    auto sec = iox::units::Duration::fromSeconds(wait_timeout->sec);
-    auto nsec = iox::units::Duration::fromNanoseconds(wait_timeout->nsec);
-    auto timeout = sec + nsec;
+    auto timeout = iox::units::Duration::fromNanoseconds(time_until_event_update);
+    if (wait_timeout) {
+      auto sec = iox::units::Duration::fromSeconds(wait_timeout->sec);
+      auto nsec = iox::units::Duration::fromNanoseconds(wait_timeout->nsec);
+      timeout = std::min(timeout, sec + nsec);
+    }
 
     waitset->timedWait(iox::units::Duration(timeout));
   }
@@ -181,6 +218,22 @@ after_wait:
     }
   }
 
+  // reset all the events that have no status change
+  if (events->event_count > 0) {
+    rcutils_system_time_now(&now);
+  }
+  for (size_t i = 0; i < events->event_count; ++i) {
+    auto event = static_cast<rmw_event_t *>(events->events[i]);
+    if (RMW_EVENT_LIVELINESS_CHANGED == event->event_type) {
+      waitset->detachEvent(
+        static_cast<IceoryxSubscription *>(event->data)->graph_change_trigger_);
+    }
+    rcutils_duration_value_t time_until_update{0};
+    if (!rmw_iceoryx_cpp::update_qos_event(event, now, time_until_update)) {
+      events->events[i] = nullptr;
+    }
+  }
+
   return RMW_RET_OK;
 }
 }  // extern "C"
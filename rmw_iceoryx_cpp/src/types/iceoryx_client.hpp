@@ -15,6 +15,10 @@
 #ifndef TYPES__ICEORYX_CLIENT_HPP_
 #define TYPES__ICEORYX_CLIENT_HPP_
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
 #include "../iceoryx_generate_gid.hpp"
 
 #include "iceoryx_posh/popo/untyped_client.hpp"
@@ -24,24 +28,74 @@
 
 #include "rmw_iceoryx_cpp/iceoryx_type_info_introspection.hpp"
 
+/// @brief Keeps track of the sequence numbers of the requests which still wait for a response.
+///        Sequence number n occupies slot n % capacity; when more requests than slots are in
+///        flight, the oldest one is evicted and its late response is dropped like an unknown one.
+class IceoryxRequestWindow
+{
+public:
+  static constexpr uint64_t MIN_CAPACITY{64U};
+
+  explicit IceoryxRequestWindow(uint64_t capacity)
+  : capacity_((capacity > MIN_CAPACITY) ? capacity : MIN_CAPACITY),
+    slots_(new std::atomic<int64_t>[capacity_])
+  {
+    for (uint64_t i = 0U; i < capacity_; ++i) {
+      slots_[i].store(FREE_SLOT, std::memory_order_relaxed);
+    }
+  }
+
+  void insert(int64_t sequence_id)
+  {
+    slot(sequence_id).store(sequence_id, std::memory_order_release);
+  }
+
+  /// @brief Removes the sequence number from the window
+  /// @return false if the sequence number was not in flight
+  bool remove(int64_t sequence_id)
+  {
+    if (sequence_id < 0) {
+      return false;
+    }
+    auto expected = sequence_id;
+    return slot(sequence_id).compare_exchange_strong(
+      expected, FREE_SLOT, std::memory_order_acq_rel);
+  }
+
+private:
+  static constexpr int64_t FREE_SLOT{-1};
+
+  std::atomic<int64_t> & slot(int64_t sequence_id)
+  {
+    return slots_[static_cast<uint64_t>(sequence_id) % capacity_];
+  }
+
+  const uint64_t capacity_;
+  std::unique_ptr<std::atomic<int64_t>[]> slots_;
+};
+
 struct IceoryxClient
 {
   IceoryxClient(
     const rosidl_service_type_support_t * type_supports,
-    iox::popo::UntypedClient * const iceoryx_client)
+    iox::popo::UntypedClient * const iceoryx_client,
+    uint64_t max_requests_in_flight)
   : type_supports_(*type_supports),
     iceoryx_client_(iceoryx_client),
     is_fixed_size_(rmw_iceoryx_cpp::iceoryx_is_fixed_size(type_supports)),
     request_size_(rmw_iceoryx_cpp::iceoryx_get_request_size(type_supports)),
-    gid_(generate_client_gid(iceoryx_client_))
+    gid_(generate_client_gid(iceoryx_client_)),
+    requests_in_flight_(max_requests_in_flight)
   {}
 
   rosidl_service_type_support_t type_supports_;
   iox::popo::UntypedClient * const iceoryx_client_;
   bool is_fixed_size_{false};
   size_t request_size_{0};
-  int64_t sequence_id_{0};
+  std::atomic<int64_t> sequence_id_{0};
   rmw_gid_t gid_;
+  /// @brief Responses are accepted in any order as long as their request is still in flight
+  IceoryxRequestWindow requests_in_flight_;
 };
 
 #endif  // TYPES__ICEORYX_CLIENT_HPP_
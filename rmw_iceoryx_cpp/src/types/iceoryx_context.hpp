@@ -0,0 +1,38 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TYPES__ICEORYX_CONTEXT_HPP_
+#define TYPES__ICEORYX_CONTEXT_HPP_
+
+#include "rmw/init.h"
+
+#include "rmw_iceoryx_cpp/iceoryx_service_discovery.hpp"
+
+#include "./iceoryx_node.hpp"
+
+/// @brief Everything the nodes of one context share, created in 'rmw_init' after the iceoryx
+///        runtime and destroyed in 'rmw_context_fini'
+struct rmw_context_impl_s
+{
+  rmw_context_impl_s()
+  : service_discovery_cache_(graph_change_notifier_.listener())
+  {
+  }
+
+  // declared first, its listener outlives the service discovery cache
+  IceoryxGraphChangeNotifier graph_change_notifier_;
+  rmw_iceoryx_cpp::ServiceDiscoveryCache service_discovery_cache_;
+};
+
+#endif  // TYPES__ICEORYX_CONTEXT_HPP_
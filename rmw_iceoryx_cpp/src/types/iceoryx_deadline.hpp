@@ -0,0 +1,117 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TYPES__ICEORYX_DEADLINE_HPP_
+#define TYPES__ICEORYX_DEADLINE_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+
+#include "rcutils/time.h"
+
+#include "rmw/time.h"
+#include "rmw/types.h"
+
+/// @brief Converts a QoS duration to nanoseconds, unspecified and infinite durations yield 0
+inline rcutils_duration_value_t iceoryx_qos_duration_to_nsec(const rmw_time_t & duration)
+{
+  if (rmw_time_equal(duration, RMW_DURATION_INFINITE)) {
+    return 0;
+  }
+  return rmw_time_total_nsec(duration);
+}
+
+/// @brief Counts the periods in which an entity was not active. There is no timer thread, the
+///        periods are evaluated lazily whenever 'update' is called, i.e. from 'rmw_wait'
+class IceoryxDeadline
+{
+public:
+  static constexpr rcutils_duration_value_t NO_UPDATE_NEEDED{
+    std::numeric_limits<rcutils_duration_value_t>::max()};
+
+  explicit IceoryxDeadline(const rmw_time_t & period)
+  : period_(iceoryx_qos_duration_to_nsec(period))
+  {
+    rcutils_time_point_value_t now{0};
+    rcutils_system_time_now(&now);
+    last_activity_.store(now, std::memory_order_relaxed);
+    period_start_ = now;
+  }
+
+  bool is_enabled() const
+  {
+    return period_ > 0;
+  }
+
+  /// @brief Marks the entity as active, i.e. a sample was published or received
+  void notify(rcutils_time_point_value_t now)
+  {
+    last_activity_.store(now, std::memory_order_relaxed);
+  }
+
+  /// @brief Time of the last activity, also used to judge the liveliness of a publisher
+  rcutils_time_point_value_t last_activity() const
+  {
+    return last_activity_.load(std::memory_order_relaxed);
+  }
+
+  /// @brief Counts the periods which expired without activity until 'now'
+  /// @return the time until the current period expires
+  rcutils_duration_value_t update(rcutils_time_point_value_t now)
+  {
+    if (!is_enabled()) {
+      return NO_UPDATE_NEEDED;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto last_activity = last_activity_.load(std::memory_order_relaxed);
+    if (last_activity > period_start_) {
+      period_start_ = last_activity;
+    }
+    auto elapsed = now - period_start_;
+    if (elapsed >= period_) {
+      auto missed = elapsed / period_;
+      total_count_ += static_cast<int32_t>(missed);
+      total_count_change_ += static_cast<int32_t>(missed);
+      period_start_ += missed * period_;
+    }
+    return period_start_ + period_ - now;
+  }
+
+  bool has_changed()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return total_count_change_ > 0;
+  }
+
+  /// @brief Hands out the missed deadline counters and resets the change counter
+  void take(int32_t & total_count, int32_t & total_count_change)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    total_count = total_count_;
+    total_count_change = total_count_change_;
+    total_count_change_ = 0;
+  }
+
+private:
+  const rcutils_duration_value_t period_;
+  std::atomic<rcutils_time_point_value_t> last_activity_{0};
+  std::mutex mutex_;
+  rcutils_time_point_value_t period_start_{0};
+  int32_t total_count_{0};
+  int32_t total_count_change_{0};
+};
+
+#endif  // TYPES__ICEORYX_DEADLINE_HPP_
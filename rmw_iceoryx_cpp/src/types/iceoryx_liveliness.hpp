@@ -0,0 +1,162 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TYPES__ICEORYX_LIVELINESS_HPP_
+#define TYPES__ICEORYX_LIVELINESS_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include "rcutils/time.h"
+
+#include "rmw/events_statuses/liveliness_changed.h"
+#include "rmw/events_statuses/liveliness_lost.h"
+#include "rmw/types.h"
+
+#include "rmw_iceoryx_cpp/iceoryx_graph_cache.hpp"
+
+#include "./iceoryx_deadline.hpp"
+
+/// @brief Tracks the MANUAL_BY_TOPIC liveliness of a publisher. Every publish call asserts the
+///        liveliness implicitly; its time is the one which is already recorded for the deadline,
+///        so liveliness adds no work to 'rmw_publish'. AUTOMATIC liveliness is covered by the
+///        process heartbeat which RouDi monitors, a publisher is alive as long as its port exists.
+class IceoryxPublisherLiveliness
+{
+public:
+  explicit IceoryxPublisherLiveliness(const rmw_qos_profile_t & qos_policies)
+  : lease_duration_(
+      (RMW_QOS_POLICY_LIVELINESS_MANUAL_BY_TOPIC == qos_policies.liveliness) ?
+      iceoryx_qos_duration_to_nsec(qos_policies.liveliness_lease_duration) : 0)
+  {
+    rcutils_time_point_value_t now{0};
+    rcutils_system_time_now(&now);
+    last_assertion_.store(now, std::memory_order_relaxed);
+  }
+
+  bool is_enabled() const
+  {
+    return lease_duration_ > 0;
+  }
+
+  void assert_liveliness(rcutils_time_point_value_t now)
+  {
+    last_assertion_.store(now, std::memory_order_relaxed);
+  }
+
+  /// @brief Checks whether the lease expired since the last assertion or publish call
+  /// @return the time after which the lease has to be checked again
+  rcutils_duration_value_t update(
+    rcutils_time_point_value_t now,
+    rcutils_time_point_value_t last_publish)
+  {
+    if (!is_enabled()) {
+      return IceoryxDeadline::NO_UPDATE_NEEDED;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto last_assertion = std::max(last_assertion_.load(std::memory_order_relaxed), last_publish);
+    if (now - last_assertion > lease_duration_) {
+      if (alive_) {
+        alive_ = false;
+        ++total_count_;
+        ++total_count_change_;
+      }
+      return lease_duration_;
+    }
+    alive_ = true;
+    return last_assertion + lease_duration_ - now;
+  }
+
+  bool has_changed()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return total_count_change_ > 0;
+  }
+
+  void take(rmw_liveliness_lost_status_t & status)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    status.total_count = total_count_;
+    status.total_count_change = total_count_change_;
+    total_count_change_ = 0;
+  }
+
+private:
+  const rcutils_duration_value_t lease_duration_;
+  std::atomic<rcutils_time_point_value_t> last_assertion_{0};
+  std::mutex mutex_;
+  bool alive_{true};
+  int32_t total_count_{0};
+  int32_t total_count_change_{0};
+};
+
+/// @brief Tracks the number of alive publishers on the topic of a subscription. A publisher is
+///        alive as long as its port is listed in the port introspection of RouDi, which removes
+///        the ports of every process whose heartbeat stops. The publishers are counted in the
+///        graph change which woke up the subscription, hence the count always matches the change
+///        that is reported. A publisher which is gone is not distinguished from one which is no
+///        longer alive, hence the not alive count is always 0 and a lost publisher decreases the
+///        alive count instead. The introspection does not carry the QoS of a publisher, hence
+///        every publisher on the topic is counted, whatever its liveliness policy.
+class IceoryxSubscriptionLiveliness
+{
+public:
+  /// @param[in] change the latest change of the iceoryx graph
+  /// @param[in] topic_name the topic of the subscription
+  void update(const rmw_iceoryx_cpp::GraphChange & change, const std::string & topic_name)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (change.generation_ == graph_generation_) {
+      return;
+    }
+    graph_generation_ = change.generation_;
+    auto alive_count = static_cast<int32_t>(change.count_publishers(topic_name));
+    if (alive_count != alive_count_) {
+      alive_count_change_ += alive_count - alive_count_;
+      alive_count_ = alive_count;
+      has_changed_ = true;
+    }
+  }
+
+  bool has_changed()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return has_changed_;
+  }
+
+  void take(rmw_liveliness_changed_status_t & status)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    status.alive_count = alive_count_;
+    status.not_alive_count = 0;
+    status.alive_count_change = alive_count_change_;
+    status.not_alive_count_change = 0;
+    alive_count_change_ = 0;
+    has_changed_ = false;
+  }
+
+private:
+  std::mutex mutex_;
+  /// @brief generation of the graph change the alive count was computed for, 0 before the
+  ///        first change as the notifier starts counting at 1
+  uint64_t graph_generation_{0U};
+  int32_t alive_count_{0};
+  int32_t alive_count_change_{0};
+  bool has_changed_{false};
+};
+
+#endif  // TYPES__ICEORYX_LIVELINESS_HPP_
@@ -15,7 +15,12 @@
 #ifndef TYPES__ICEORYX_NODE_HPP_
 #define TYPES__ICEORYX_NODE_HPP_
 
+#include <algorithm>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include "iceoryx_posh/popo/untyped_subscriber.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
@@ -27,32 +32,27 @@
 #include "rmw/impl/cpp/macros.hpp"
 #include "rmw/rmw.h"
 
+#include "rmw_iceoryx_cpp/iceoryx_graph_cache.hpp"
+#include "rmw_iceoryx_cpp/iceoryx_service_discovery.hpp"
+
 #include "../iceoryx_identifier.hpp"
+#include "../iceoryx_qos_events.hpp"
 #include "iceoryx_posh/popo/user_trigger.hpp"
 
 // We currently use the iceoryx port introspection
 // which is updated whenever a sender port comes or goes or
-// does OFFER / STOP_OFFER or a receiver port comes or goes or does SUB / UNSUB
-/// @todo poehnl: check with the list of ros2 graph events
+// does OFFER / STOP_OFFER or a receiver port comes or goes or does SUB / UNSUB.
+// The samples are diffed and only changes of the endpoints ROS sees trigger the guard conditions
 
+/// @brief There is one notifier per context, it fans out every graph change to the graph guard
+///        conditions of all nodes and to the subscriptions which track the liveliness of their
+///        publishers, hence a context has only one listener thread and one introspection
+///        subscriber no matter how many nodes it creates
 class IceoryxGraphChangeNotifier
 {
 public:
-  explicit IceoryxGraphChangeNotifier(rmw_guard_condition_t * guard_condition)
+  IceoryxGraphChangeNotifier()
   {
-    if (!guard_condition || !guard_condition->data) {
-      RMW_SET_ERROR_MSG("invalid input for GraphChangeNotifier");
-      iceoryx_guard_condition_ = nullptr;
-    } else {
-      iceoryx_guard_condition_ = static_cast<iox::popo::UserTrigger *>(guard_condition->data);
-      RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
-        IceoryxGraphChangeNotifier
-        : guard_condition,
-        guard_condition->implementation_identifier,
-        rmw_get_implementation_identifier(),
-        iceoryx_guard_condition_ = nullptr);
-    }
-
     /// @todo change to the dds_common graph
     // subscribe with a callback for changes in the iceoryx graph
     // https://github.com/eclipse-iceoryx/iceoryx/issues/707
@@ -73,6 +73,62 @@ public:
     port_receiver_.unsubscribe();
   }
 
+  /// @brief Triggers the guard condition on every graph change until it is detached
+  rmw_ret_t attach(rmw_guard_condition_t * guard_condition)
+  {
+    if (!guard_condition || !guard_condition->data) {
+      RMW_SET_ERROR_MSG("invalid input for GraphChangeNotifier");
+      return RMW_RET_INVALID_ARGUMENT;
+    }
+    RMW_CHECK_TYPE_IDENTIFIERS_MATCH(
+      IceoryxGraphChangeNotifier
+      : guard_condition,
+      guard_condition->implementation_identifier,
+      rmw_get_implementation_identifier(),
+      return RMW_RET_INCORRECT_RMW_IMPLEMENTATION);
+
+    attach(static_cast<iox::popo::UserTrigger *>(guard_condition->data));
+    return RMW_RET_OK;
+  }
+
+  /// @brief Triggers the trigger on every graph change until it is detached
+  void attach(iox::popo::UserTrigger * trigger)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    triggers_.push_back(trigger);
+  }
+
+  /// @brief Must be called before the guard condition is destroyed
+  void detach(rmw_guard_condition_t * guard_condition)
+  {
+    if (!guard_condition || !guard_condition->data) {
+      return;
+    }
+    detach(static_cast<iox::popo::UserTrigger *>(guard_condition->data));
+  }
+
+  /// @brief Must be called before the trigger is destroyed
+  void detach(iox::popo::UserTrigger * trigger)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    triggers_.erase(std::remove(triggers_.begin(), triggers_.end(), trigger), triggers_.end());
+  }
+
+  /// @brief Other events of the context are attached to this listener as well, so that a
+  ///        context has a single listener thread
+  iox::popo::Listener & listener()
+  {
+    return listener_;
+  }
+
+  /// @brief The latest ROS-visible change of the graph, nullptr before the first one. Only the
+  ///        latest change is kept, a consumer which sees a gap in the generation has missed one
+  ///        and needs to query the whole graph instead
+  std::shared_ptr<const rmw_iceoryx_cpp::GraphChange> latest_change() const
+  {
+    return std::atomic_load(&latest_change_);
+  }
+
 private:
   // must be a static method to be convertable to c function pointer
   // second argument (self) is the this pointer of the current object
@@ -80,14 +136,56 @@ private:
     iox::popo::UntypedSubscriber * introspectionSubscriber,
     IceoryxGraphChangeNotifier * self)
   {
-    if (nullptr != self->iceoryx_guard_condition_) {
-      self->iceoryx_guard_condition_->trigger();
+    if (nullptr == introspectionSubscriber) {
+      return;
+    }
+
+    // only the latest sample is of interest
+    const void * latest_user_payload = nullptr;
+    while (introspectionSubscriber->take()
+      .and_then(
+        [&](const void * userPayload) {
+          if (latest_user_payload) {
+            introspectionSubscriber->release(latest_user_payload);
+          }
+          latest_user_payload = userPayload;
+        }))
+    {
+    }
+    if (!latest_user_payload) {
+      return;
     }
-    if (nullptr != introspectionSubscriber) {
-      introspectionSubscriber->releaseQueuedData();
+
+    auto endpoints = rmw_iceoryx_cpp::collect_graph_endpoints(
+      *static_cast<const iox::roudi::PortIntrospectionFieldTopic *>(latest_user_payload));
+    introspectionSubscriber->release(latest_user_payload);
+
+    // RouDi also publishes on changes ROS does not see, e.g. of the iceoryx internal ports
+    auto change = std::make_shared<rmw_iceoryx_cpp::GraphChange>(
+      rmw_iceoryx_cpp::diff_graph_endpoints(self->endpoints_, endpoints));
+    if (change->empty()) {
+      return;
+    }
+    change->topic_publisher_counts_ = rmw_iceoryx_cpp::count_graph_publishers(endpoints);
+    self->endpoints_ = std::move(endpoints);
+    change->generation_ =
+      rmw_iceoryx_cpp::graph_generation().fetch_add(1U, std::memory_order_relaxed) + 1U;
+    std::atomic_store(
+      &self->latest_change_,
+      std::shared_ptr<const rmw_iceoryx_cpp::GraphChange>(std::move(change)));
+
+    std::lock_guard<std::mutex> lock(self->mutex_);
+    for (auto trigger : self->triggers_) {
+      trigger->trigger();
     }
   }
-  iox::popo::UserTrigger * iceoryx_guard_condition_{nullptr};
+  std::mutex mutex_;
+  /// @brief The graph guard conditions of the nodes and the graph change triggers of the
+  ///        subscriptions
+  std::vector<iox::popo::UserTrigger *> triggers_;
+  // only accessed by the listener thread
+  std::vector<rmw_iceoryx_cpp::GraphEndpoint> endpoints_;
+  std::shared_ptr<const rmw_iceoryx_cpp::GraphChange> latest_change_;
   using port_receiver_t = iox::popo::UntypedSubscriber;
   port_receiver_t port_receiver_{iox::roudi::IntrospectionPortService,
     iox::popo::SubscriberOptions{1U, 1U, "", true}};
@@ -100,14 +198,19 @@ struct IceoryxNodeInfo
   IceoryxNodeInfo(
     rmw_guard_condition_t * guard_condition,
     IceoryxGraphChangeNotifier * graph_change_notifier,
+    rmw_iceoryx_cpp::ServiceDiscoveryCache * service_discovery_cache,
     iox::runtime::Node * iceoryx_runnable)
   : guard_condition_(guard_condition),
     graph_change_notifier_(graph_change_notifier),
+    service_discovery_cache_(service_discovery_cache),
     iceoryx_runnable_(iceoryx_runnable)
   {
   }
   rmw_guard_condition_t * const guard_condition_;
+  /// @brief Owned by the context, the node only attaches its guard condition
   IceoryxGraphChangeNotifier * const graph_change_notifier_;
+  /// @brief Owned by the context
+  rmw_iceoryx_cpp::ServiceDiscoveryCache * const service_discovery_cache_;
   iox::runtime::Node * const iceoryx_runnable_;
 };
 
@@ -16,7 +16,11 @@
 #ifndef TYPES__ICEORYX_PUBLISHER_HPP_
 #define TYPES__ICEORYX_PUBLISHER_HPP_
 
+#include <atomic>
+
 #include "../iceoryx_generate_gid.hpp"
+#include "./iceoryx_deadline.hpp"
+#include "./iceoryx_liveliness.hpp"
 
 #include "iceoryx_posh/popo/untyped_publisher.hpp"
 
@@ -29,12 +33,19 @@ struct IceoryxPublisher
 {
   IceoryxPublisher(
     const rosidl_message_type_support_t * type_supports,
-    iox::popo::UntypedPublisher * const iceoryx_sender)
+    iox::popo::UntypedPublisher * const iceoryx_sender,
+    const rmw_qos_profile_t * qos_policies)
   : type_supports_(*type_supports),
     iceoryx_sender_(iceoryx_sender),
     gid_(generate_publisher_gid(iceoryx_sender_)),
     is_fixed_size_(rmw_iceoryx_cpp::iceoryx_is_fixed_size(type_supports)),
-    message_size_(rmw_iceoryx_cpp::iceoryx_get_message_size(type_supports))
+    message_size_(rmw_iceoryx_cpp::iceoryx_get_message_size(type_supports)),
+    qos_(*qos_policies),
+    has_history_(RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL == qos_policies->durability),
+    lifespan_(iceoryx_qos_duration_to_nsec(qos_policies->lifespan)),
+    deadline_(qos_policies->deadline),
+    liveliness_(*qos_policies),
+    reads_clock_(lifespan_ > 0 || deadline_.is_enabled() || liveliness_.is_enabled())
   {}
 
   rosidl_message_type_support_t type_supports_;
@@ -42,6 +53,18 @@ struct IceoryxPublisher
   rmw_gid_t gid_;
   bool is_fixed_size_;
   size_t message_size_;
+  /// @brief Number of 'rmw_publish' calls which returned early as no subscription was matched
+  std::atomic<uint64_t> skipped_publish_count_{0U};
+  rmw_qos_profile_t qos_;
+  /// @brief True if the publisher keeps samples for late-joining subscriptions
+  bool has_history_;
+  /// @brief Lifespan in nanoseconds which is stamped into every chunk, 0 if infinite
+  rcutils_duration_value_t lifespan_;
+  IceoryxDeadline deadline_;
+  IceoryxPublisherLiveliness liveliness_;
+  /// @brief Only lifespan, deadline and MANUAL_BY_TOPIC liveliness need the publish time,
+  ///        without them publishing doesn't read the clock and the chunks carry no timestamps
+  bool reads_clock_;
 };
 
 #endif  // TYPES__ICEORYX_PUBLISHER_HPP_
@@ -15,24 +15,218 @@
 #ifndef TYPES__ICEORYX_SERVER_HPP_
 #define TYPES__ICEORYX_SERVER_HPP_
 
-#include <map>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
 
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/popo/untyped_server.hpp"
 
+#include "rcutils/time.h"
+
 #include "rmw/rmw.h"
 #include "rmw/types.h"
 
 #include "rmw_iceoryx_cpp/iceoryx_type_info_introspection.hpp"
 
+/// @brief Fixed-capacity hash table with linear probing which maps the (client id, sequence
+///        number) of a taken request to its sample pointer. All memory is allocated on
+///        construction, inserting and removing never allocates. Loaned requests are handed out
+///        to the user as they are and are therefore only removed with their response.
+class IceoryxHeldRequests
+{
+public:
+  /// @param[in] max_held the number of requests which may be held at the same time
+  explicit IceoryxHeldRequests(uint64_t max_held)
+  : max_size_(max_held > 0U ? max_held : 1U)
+  {
+    // keep the load factor at or below one half to keep the probe sequences short
+    capacity_ = 1U;
+    while (capacity_ < 2U * max_size_) {
+      capacity_ <<= 1U;
+    }
+    entries_.reset(new Entry[capacity_]);
+  }
+
+  bool empty() const
+  {
+    return size_ == 0U;
+  }
+
+  bool full() const
+  {
+    return size_ >= max_size_;
+  }
+
+  /// @param[in] taken_at steady time at which the request was taken, used for reclamation
+  /// @param[in] loaned true if the user reads the request in place, it is never reclaimed
+  /// @return false if the table is full or the request is already held
+  bool insert(
+    uint64_t client_id, int64_t sequence_id, const void * request_payload,
+    rcutils_time_point_value_t taken_at, bool loaned = false)
+  {
+    if (full()) {
+      return false;
+    }
+    for (auto i = home(client_id, sequence_id); ; i = next(i)) {
+      auto & entry = entries_[i];
+      if (!entry.request_payload_) {
+        entry = Entry{client_id, sequence_id, request_payload, taken_at, loaned};
+        ++size_;
+        if (!loaned && taken_at < oldest_taken_at_) {
+          oldest_taken_at_ = taken_at;
+        }
+        return true;
+      }
+      if (entry.client_id_ == client_id && entry.sequence_id_ == sequence_id) {
+        return false;
+      }
+    }
+  }
+
+  /// @return the held sample pointer or nullptr if the request is not held; it stays held
+  const void * find(uint64_t client_id, int64_t sequence_id) const
+  {
+    for (auto i = home(client_id, sequence_id); ; i = next(i)) {
+      const auto & entry = entries_[i];
+      if (!entry.request_payload_) {
+        return nullptr;
+      }
+      if (entry.client_id_ == client_id && entry.sequence_id_ == sequence_id) {
+        return entry.request_payload_;
+      }
+    }
+  }
+
+  /// @return the held sample pointer or nullptr if the request is not held
+  const void * remove(uint64_t client_id, int64_t sequence_id)
+  {
+    for (auto i = home(client_id, sequence_id); ; i = next(i)) {
+      auto & entry = entries_[i];
+      if (!entry.request_payload_) {
+        return nullptr;
+      }
+      if (entry.client_id_ == client_id && entry.sequence_id_ == sequence_id) {
+        auto request_payload = entry.request_payload_;
+        erase(i);
+        --size_;
+        return request_payload;
+      }
+    }
+  }
+
+  /// @brief Removes all requests which were taken at or before 'deadline' and hands their
+  ///        sample pointers to 'release'; loaned requests are kept
+  /// @return the number of removed requests
+  template<typename ReleaseFunction>
+  uint64_t remove_taken_before(rcutils_time_point_value_t deadline, ReleaseFunction release)
+  {
+    // most takes find nothing to do, the oldest take time tells without a scan
+    if (oldest_taken_at_ > deadline) {
+      return 0U;
+    }
+    uint64_t removed{0U};
+    oldest_taken_at_ = NEVER_TAKEN;
+    for (uint64_t i = 0U; i < capacity_; ) {
+      auto & entry = entries_[i];
+      const bool reclaimable = entry.request_payload_ && !entry.loaned_;
+      if (reclaimable && entry.taken_at_ <= deadline) {
+        release(entry.request_payload_);
+        erase(i);
+        --size_;
+        ++removed;
+        // an entry might have been shifted into this slot, so check it again
+        continue;
+      }
+      if (reclaimable && entry.taken_at_ < oldest_taken_at_) {
+        oldest_taken_at_ = entry.taken_at_;
+      }
+      ++i;
+    }
+    return removed;
+  }
+
+  /// @brief Removes the request which is held the longest and hands it to 'release'. Requests
+  ///        which were taken at the same time are removed together, loaned requests are kept.
+  /// @return the number of removed requests, 0 if no request can be removed
+  template<typename ReleaseFunction>
+  uint64_t remove_oldest(ReleaseFunction release)
+  {
+    if (oldest_taken_at_ == NEVER_TAKEN) {
+      return 0U;
+    }
+    auto removed = remove_taken_before(oldest_taken_at_, release);
+    if (removed > 0U || oldest_taken_at_ == NEVER_TAKEN) {
+      return removed;
+    }
+    // the lower bound was outdated, the scan made it exact
+    return remove_taken_before(oldest_taken_at_, release);
+  }
+
+private:
+  static constexpr rcutils_time_point_value_t NEVER_TAKEN{
+    std::numeric_limits<rcutils_time_point_value_t>::max()};
+
+  struct Entry
+  {
+    uint64_t client_id_{0U};
+    int64_t sequence_id_{0};
+    /// @brief nullptr marks an empty slot
+    const void * request_payload_{nullptr};
+    rcutils_time_point_value_t taken_at_{0};
+    bool loaned_{false};
+  };
+
+  uint64_t home(uint64_t client_id, int64_t sequence_id) const
+  {
+    uint64_t hash = client_id * 0x9E3779B97F4A7C15ULL ^ static_cast<uint64_t>(sequence_id);
+    hash ^= hash >> 32U;
+    return hash & (capacity_ - 1U);
+  }
+
+  uint64_t next(uint64_t index) const
+  {
+    return (index + 1U) & (capacity_ - 1U);
+  }
+
+  /// @brief Backward shift deletion, moves following entries into the gap so that no
+  ///        tombstones are needed
+  void erase(uint64_t gap)
+  {
+    entries_[gap] = Entry{};
+    for (auto i = next(gap); entries_[i].request_payload_; i = next(i)) {
+      auto preferred = home(entries_[i].client_id_, entries_[i].sequence_id_);
+      // the entry may only move if its preferred slot is not cyclically within (gap, i]
+      bool stays = (gap < i) ? (gap < preferred && preferred <= i) :
+        (gap < preferred || preferred <= i);
+      if (!stays) {
+        entries_[gap] = entries_[i];
+        entries_[i] = Entry{};
+        gap = i;
+      }
+    }
+  }
+
+  uint64_t capacity_{0U};
+  const uint64_t max_size_;
+  uint64_t size_{0U};
+  /// @brief Lower bound of the take times of all held requests which are not loaned
+  rcutils_time_point_value_t oldest_taken_at_{NEVER_TAKEN};
+  std::unique_ptr<Entry[]> entries_;
+};
+
 struct IceoryxServer
 {
   IceoryxServer(
     const rosidl_service_type_support_t * type_supports,
-    iox::popo::UntypedServer * const iceoryx_server)
+    iox::popo::UntypedServer * const iceoryx_server,
+    uint64_t max_held_requests)
   : type_supports_(*type_supports),
     iceoryx_server_(iceoryx_server),
     is_fixed_size_(rmw_iceoryx_cpp::iceoryx_is_fixed_size(type_supports)),
-    response_size_(rmw_iceoryx_cpp::iceoryx_get_response_size(type_supports))
+    response_size_(rmw_iceoryx_cpp::iceoryx_get_response_size(type_supports)),
+    held_requests_(max_held_requests)
   {
   }
 
@@ -40,11 +234,19 @@ struct IceoryxServer
   iox::popo::UntypedServer * const iceoryx_server_;
   bool is_fixed_size_{false};
   size_t response_size_{0};
-  /// @brief The map stores the sequence numbers together with the corresponding
+  /// @brief Stores the client id and sequence number together with the corresponding
   ///        sample pointer pointing to the shared memory. This is due to the fact that
   ///        'rmw_request_id_t' misses a place to store the sample pointer, which is not
   ///        typical with DDS implementations.
-  std::map<int64_t, const void *> request_payload_map_;
+  IceoryxHeldRequests held_requests_;
+  /// @brief Requests without a response are released after this time, 0 means never; set by
+  ///        'set_held_request_reclamation'
+  std::atomic<rcutils_duration_value_t> request_hold_timeout_{0};
+  /// @brief If set, the oldest held request is released when all places are taken, otherwise
+  ///        no request is taken until a response is sent
+  std::atomic<bool> evict_held_requests_{false};
+  /// @brief Number of held requests which were released without a response being sent
+  std::atomic<uint64_t> reclaimed_request_count_{0U};
 };
 
 #endif  // TYPES__ICEORYX_SERVER_HPP_
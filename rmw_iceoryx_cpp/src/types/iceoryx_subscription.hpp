@@ -16,27 +16,50 @@
 #define TYPES__ICEORYX_SUBSCRIPTION_HPP_
 
 #include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/popo/user_trigger.hpp"
+
+#include <string>
+
+#include "./iceoryx_deadline.hpp"
+#include "./iceoryx_liveliness.hpp"
 
 #include "rmw/rmw.h"
 #include "rmw/types.h"
 
 #include "rmw_iceoryx_cpp/iceoryx_type_info_introspection.hpp"
 
+class IceoryxGraphChangeNotifier;
+
 struct IceoryxSubscription
 {
   IceoryxSubscription(
     const rosidl_message_type_support_t * type_supports,
-    iox::popo::UntypedSubscriber * const iceoryx_receiver)
+    iox::popo::UntypedSubscriber * const iceoryx_receiver,
+    const rmw_qos_profile_t * qos_policies,
+    const char * topic_name)
   : type_supports_(*type_supports),
     iceoryx_receiver_(iceoryx_receiver),
     is_fixed_size_(rmw_iceoryx_cpp::iceoryx_is_fixed_size(type_supports)),
-    message_size_(rmw_iceoryx_cpp::iceoryx_get_message_size(type_supports))
+    message_size_(rmw_iceoryx_cpp::iceoryx_get_message_size(type_supports)),
+    qos_(*qos_policies),
+    deadline_(qos_policies->deadline),
+    topic_name_(topic_name)
   {}
 
   rosidl_message_type_support_t type_supports_;
   iox::popo::UntypedSubscriber * const iceoryx_receiver_;
   bool is_fixed_size_;
   size_t message_size_;
+  rmw_qos_profile_t qos_;
+  IceoryxDeadline deadline_;
+  IceoryxSubscriptionLiveliness liveliness_;
+  /// @brief Triggered by the graph change notifier of the context, 'rmw_wait' attaches it while
+  ///        it waits for a liveliness changed event of the subscription
+  iox::popo::UserTrigger graph_change_trigger_;
+  /// @brief The notifier the trigger is attached to, the liveliness is evaluated against its
+  ///        latest change; nullptr if the subscription was created without one
+  const IceoryxGraphChangeNotifier * graph_change_notifier_{nullptr};
+  std::string topic_name_;
 };
 
 #endif  // TYPES__ICEORYX_SUBSCRIPTION_HPP_
@@ -0,0 +1,61 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TYPES__ICEORYX_USER_HEADER_HPP_
+#define TYPES__ICEORYX_USER_HEADER_HPP_
+
+#include <cstdint>
+#include <new>
+
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include "rcutils/time.h"
+
+/// @brief The user header which is placed in front of every chunk sent by an rmw_iceoryx_cpp
+///        publisher. It allows a subscription to judge a sample without touching its payload.
+struct IceoryxUserHeader
+{
+  /// @brief iceoryx marks every user header as UNKNOWN_USER_HEADER, hence the header carries an
+  ///        id of its own to tell it apart from the user header of a non-ROS publisher
+  static constexpr uint32_t ID{0x49574D52U};  // "RMWI"
+
+  uint32_t id_{ID};
+  /// @brief Time at which the chunk was published, 0 if the QoS of the publisher needs no clock
+  rcutils_time_point_value_t source_timestamp_{0};
+  /// @brief Time after which the chunk must not be delivered anymore, 0 if it never expires
+  rcutils_time_point_value_t expiry_timestamp_{0};
+};
+
+/// @brief Constructs the user header in a chunk which was loaned with room for it
+inline IceoryxUserHeader * init_iceoryx_user_header(void * user_payload)
+{
+  auto chunk_header = iox::mepoo::ChunkHeader::fromUserPayload(user_payload);
+  return new (chunk_header->userHeader()) IceoryxUserHeader();
+}
+
+/// @return the user header if the chunk was sent by an rmw_iceoryx_cpp publisher, nullptr if
+///         it was sent by a non-ROS publisher with no or another user header
+inline const IceoryxUserHeader * get_iceoryx_user_header(const void * user_payload)
+{
+  auto chunk_header = iox::mepoo::ChunkHeader::fromUserPayload(user_payload);
+  if (chunk_header->userHeaderId() == iox::mepoo::ChunkHeader::NO_USER_HEADER ||
+    chunk_header->userHeaderSize() != sizeof(IceoryxUserHeader))
+  {
+    return nullptr;
+  }
+  auto user_header = static_cast<const IceoryxUserHeader *>(chunk_header->userHeader());
+  return (user_header->id_ == IceoryxUserHeader::ID) ? user_header : nullptr;
+}
+
+#endif  // TYPES__ICEORYX_USER_HEADER_HPP_
@@ -0,0 +1,193 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcutils/allocator.h"
+
+#include "rmw/names_and_types.h"
+
+#include "rmw_iceoryx_cpp/iceoryx_graph_cache.hpp"
+#include "rmw_iceoryx_cpp/iceoryx_topic_names_and_types.hpp"
+
+using performance_test_fixture::PerformanceTest;
+
+namespace
+{
+// every topic has four endpoints and every node ten, roughly like a large ROS 2 system
+constexpr size_t ENDPOINTS_PER_TOPIC{4U};
+constexpr size_t ENDPOINTS_PER_NODE{10U};
+
+template<typename PortDataT>
+PortDataT make_port(size_t topic_index, size_t node_index)
+{
+  auto topic = "/topic_" + std::to_string(topic_index);
+  auto node = "/ns/node_" + std::to_string(node_index);
+  PortDataT port;
+  port.m_caproServiceID = iox::capro::IdString_t(iox::cxx::TruncateToCapacity, "pkg/msg/Type");
+  port.m_caproInstanceID = iox::capro::IdString_t(iox::cxx::TruncateToCapacity, topic);
+  port.m_caproEventMethodID = iox::capro::IdString_t(iox::cxx::TruncateToCapacity, "data");
+  port.m_node = iox::NodeName_t(iox::cxx::TruncateToCapacity, node);
+  return port;
+}
+}  // namespace
+
+/// @brief Feeds a synthetic port and process introspection sample through the graph layer, no
+///        RouDi is needed. The range argument is the requested number of ports, it is capped
+///        by the capacity of the introspection samples and reported as 'ports'.
+class GraphPerformanceTest : public PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & st) override
+  {
+    const auto requested_ports = static_cast<size_t>(st.range(0));
+    // the samples are too large for the stack
+    port_sample_.reset(new iox::roudi::PortIntrospectionFieldTopic());
+    process_sample_.reset(new iox::roudi::ProcessIntrospectionFieldTopic());
+
+    const size_t publishers =
+      std::min<size_t>(requested_ports / 2U, port_sample_->m_publisherList.capacity());
+    const size_t subscribers = std::min<size_t>(
+      requested_ports - publishers, port_sample_->m_subscriberList.capacity());
+    for (size_t i = 0U; i < publishers + subscribers; ++i) {
+      auto topic_index = i / ENDPOINTS_PER_TOPIC;
+      auto node_index = i / ENDPOINTS_PER_NODE;
+      if (i < publishers) {
+        port_sample_->m_publisherList.push_back(
+          make_port<iox::roudi::PublisherPortData>(topic_index, node_index));
+      } else {
+        port_sample_->m_subscriberList.push_back(
+          make_port<iox::roudi::SubscriberPortData>(topic_index, node_index));
+      }
+    }
+    ports_ = publishers + subscribers;
+    topic_name_ = "/topic_" + std::to_string(ports_ / ENDPOINTS_PER_TOPIC / 2U);
+
+    const size_t nodes = (ports_ + ENDPOINTS_PER_NODE - 1U) / ENDPOINTS_PER_NODE;
+    iox::roudi::ProcessIntrospectionData process;
+    for (size_t i = 0U; i < nodes; ++i) {
+      if (process.m_nodes.size() == process.m_nodes.capacity()) {
+        if (process_sample_->m_processList.size() == process_sample_->m_processList.capacity()) {
+          break;
+        }
+        process_sample_->m_processList.push_back(process);
+        process.m_nodes.clear();
+      }
+      process.m_nodes.push_back(
+        iox::NodeName_t(iox::cxx::TruncateToCapacity, "/ns/node_" + std::to_string(i)));
+    }
+    if (!process.m_nodes.empty() &&
+      process_sample_->m_processList.size() < process_sample_->m_processList.capacity())
+    {
+      process_sample_->m_processList.push_back(process);
+    }
+
+    snapshot_ = rmw_iceoryx_cpp::build_graph_snapshot(*port_sample_);
+    endpoints_ = rmw_iceoryx_cpp::collect_graph_endpoints(*port_sample_);
+    st.counters["ports"] = static_cast<double>(ports_);
+
+    PerformanceTest::SetUp(st);
+  }
+
+  void TearDown(benchmark::State & st) override
+  {
+    PerformanceTest::TearDown(st);
+    port_sample_.reset();
+    process_sample_.reset();
+  }
+
+protected:
+  std::unique_ptr<iox::roudi::PortIntrospectionFieldTopic> port_sample_;
+  std::unique_ptr<iox::roudi::ProcessIntrospectionFieldTopic> process_sample_;
+  rmw_iceoryx_cpp::GraphSnapshot snapshot_;
+  std::vector<rmw_iceoryx_cpp::GraphEndpoint> endpoints_;
+  size_t ports_{0U};
+  std::string topic_name_;
+};
+
+// the work of the graph cache for every port introspection sample
+BENCHMARK_DEFINE_F(GraphPerformanceTest, build_graph_snapshot)(benchmark::State & st)
+{
+  reset_heap_counters();
+  for (auto _ : st) {
+    auto snapshot = rmw_iceoryx_cpp::build_graph_snapshot(*port_sample_);
+    benchmark::DoNotOptimize(snapshot);
+  }
+}
+BENCHMARK_REGISTER_F(GraphPerformanceTest, build_graph_snapshot)
+->RangeMultiplier(10)->Range(10, 10000);
+
+// the work of the graph change notifier for every port introspection sample
+BENCHMARK_DEFINE_F(GraphPerformanceTest, diff_graph_endpoints)(benchmark::State & st)
+{
+  reset_heap_counters();
+  for (auto _ : st) {
+    auto endpoints = rmw_iceoryx_cpp::collect_graph_endpoints(*port_sample_);
+    auto change = rmw_iceoryx_cpp::diff_graph_endpoints(endpoints_, endpoints);
+    benchmark::DoNotOptimize(change);
+  }
+}
+BENCHMARK_REGISTER_F(GraphPerformanceTest, diff_graph_endpoints)
+->RangeMultiplier(10)->Range(10, 10000);
+
+// rmw_count_publishers and rmw_count_subscribers on a cached snapshot
+BENCHMARK_DEFINE_F(GraphPerformanceTest, count_endpoints)(benchmark::State & st)
+{
+  reset_heap_counters();
+  for (auto _ : st) {
+    auto count = snapshot_.count_endpoints(topic_name_);
+    benchmark::DoNotOptimize(count);
+  }
+}
+BENCHMARK_REGISTER_F(GraphPerformanceTest, count_endpoints)
+->RangeMultiplier(10)->Range(10, 10000);
+
+// rmw_get_topic_names_and_types on a cached snapshot
+BENCHMARK_DEFINE_F(GraphPerformanceTest, topic_names_and_types)(benchmark::State & st)
+{
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  reset_heap_counters();
+  for (auto _ : st) {
+    rmw_names_and_types_t names_and_types = rmw_get_zero_initialized_names_and_types();
+    if (RMW_RET_OK != rmw_iceoryx_cpp::fill_rmw_names_and_types(
+        &names_and_types, snapshot_.names_n_types_, &allocator))
+    {
+      st.SkipWithError("fill_rmw_names_and_types failed");
+      break;
+    }
+    if (RMW_RET_OK != rmw_names_and_types_fini(&names_and_types)) {
+      st.SkipWithError("rmw_names_and_types_fini failed");
+      break;
+    }
+  }
+}
+BENCHMARK_REGISTER_F(GraphPerformanceTest, topic_names_and_types)
+->RangeMultiplier(10)->Range(10, 10000);
+
+// the work of the node names cache for every process introspection sample
+BENCHMARK_DEFINE_F(GraphPerformanceTest, build_node_names_snapshot)(benchmark::State & st)
+{
+  reset_heap_counters();
+  for (auto _ : st) {
+    auto snapshot = rmw_iceoryx_cpp::build_node_names_snapshot(*process_sample_);
+    benchmark::DoNotOptimize(snapshot);
+  }
+}
+BENCHMARK_REGISTER_F(GraphPerformanceTest, build_node_names_snapshot)
+->RangeMultiplier(10)->Range(10, 10000);
@@ -0,0 +1,353 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rmw/error_handling.h"
+#include "rmw/rmw.h"
+
+#include "rosidl_typesupport_cpp/message_type_support.hpp"
+
+#include "test_msgs/msg/basic_types.hpp"
+#include "test_msgs/msg/unbounded_sequences.hpp"
+
+#include "../benchmark_latencies.hpp"
+#include "../rmw_roudi_environment.hpp"
+
+using performance_test_fixture::PerformanceTest;
+
+namespace
+{
+constexpr rmw_time_t WAIT_TIMEOUT{1U, 0U};
+// messages in flight in a pipelined run, the queue of a subscription holds all of them
+constexpr size_t PIPELINE_DEPTH{10U};
+
+const std::vector<int64_t> PAYLOAD_SIZES{64, 1024, 16 * 1024, 128 * 1024, 512 * 1024};
+const std::vector<int64_t> SUBSCRIPTION_COUNTS{1, 2, 4, 8};
+
+void subscription_args(benchmark::internal::Benchmark * b)
+{
+  for (auto subscriptions : SUBSCRIPTION_COUNTS) {
+    b->Args({subscriptions});
+  }
+}
+
+void subscription_and_payload_args(benchmark::internal::Benchmark * b)
+{
+  for (auto payload_size : PAYLOAD_SIZES) {
+    for (auto subscriptions : SUBSCRIPTION_COUNTS) {
+      b->Args({subscriptions, payload_size});
+    }
+  }
+}
+}  // namespace
+
+/// @brief One publisher and range(0) subscriptions on a topic of their own, using the rmw API
+///        on top of a RouDi in this process. An iteration of a lock-step run publishes one
+///        message and waits until every subscription has taken it, like a single threaded
+///        executor would; the time this takes is recorded as the latency of the message, hence
+///        its items per second are the inverse of the latency. An iteration of a pipelined run
+///        publishes PIPELINE_DEPTH messages before taking them, its items per second are the
+///        throughput.
+template<typename MessageT>
+class PubSubPerformanceTest : public PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & st) override
+  {
+    auto & environment = RmwRouDiEnvironment::instance();
+    auto ts = rosidl_typesupport_cpp::get_message_type_support_handle<MessageT>();
+
+    const auto topic_name = unique_run_name("/benchmark_pub_sub_");
+    auto qos = rmw_qos_profile_default;
+    qos.depth = PIPELINE_DEPTH;
+
+    auto publisher_options = rmw_get_default_publisher_options();
+    publisher_ = rmw_create_publisher(
+      environment.node(), ts, topic_name.c_str(), &qos, &publisher_options);
+    auto subscription_options = rmw_get_default_subscription_options();
+    const auto subscription_count = static_cast<size_t>(st.range(0));
+    for (size_t i = 0U; i < subscription_count; ++i) {
+      auto subscription = rmw_create_subscription(
+        environment.node(), ts, topic_name.c_str(), &qos, &subscription_options);
+      if (!subscription) {
+        break;
+      }
+      subscriptions_.push_back(subscription);
+    }
+    wait_set_ = rmw_create_wait_set(environment.context(), subscription_count);
+    ready_.resize(subscriptions_.size());
+    ready_index_.resize(subscriptions_.size());
+    taken_.resize(subscriptions_.size());
+
+    if (!publisher_ || subscriptions_.size() != subscription_count || !wait_set_) {
+      st.SkipWithError(rmw_get_error_string().str);
+    } else {
+      // a publisher without a connected subscription drops the message, so wait until RouDi
+      // connected all subscriptions and check it with a first message
+      environment.discover();
+      MessageT message;
+      if (RMW_RET_OK != rmw_publish(publisher_, &message, nullptr) || !take_from_all(false)) {
+        st.SkipWithError("the subscriptions did not receive the first message");
+      }
+    }
+    st.counters["subscriptions"] = static_cast<double>(subscription_count);
+
+    PerformanceTest::SetUp(st);
+  }
+
+  void TearDown(benchmark::State & st) override
+  {
+    PerformanceTest::TearDown(st);
+
+    auto node = RmwRouDiEnvironment::instance().node();
+    if (wait_set_) {
+      (void)rmw_destroy_wait_set(wait_set_);
+      wait_set_ = nullptr;
+    }
+    for (auto subscription : subscriptions_) {
+      (void)rmw_destroy_subscription(node, subscription);
+    }
+    subscriptions_.clear();
+    if (publisher_) {
+      (void)rmw_destroy_publisher(node, publisher_);
+      publisher_ = nullptr;
+    }
+    latencies_.clear();
+  }
+
+protected:
+  /// @brief Wait until every subscription has taken 'messages' messages, a loaned message is
+  ///        returned right away
+  bool take_from_all(bool loaned, size_t messages = 1U)
+  {
+    std::fill(taken_.begin(), taken_.end(), 0U);
+    size_t pending = subscriptions_.size() * messages;
+    while (pending > 0U) {
+      size_t count = 0U;
+      for (size_t i = 0U; i < subscriptions_.size(); ++i) {
+        if (taken_[i] < messages) {
+          ready_[count] = subscriptions_[i]->data;
+          ready_index_[count] = i;
+          ++count;
+        }
+      }
+      rmw_subscriptions_t subscriptions{count, ready_.data()};
+      rmw_guard_conditions_t guard_conditions{0U, nullptr};
+      rmw_services_t services{0U, nullptr};
+      rmw_clients_t clients{0U, nullptr};
+      rmw_events_t events{0U, nullptr};
+      if (RMW_RET_OK != rmw_wait(
+          &subscriptions, &guard_conditions, &services, &clients, &events, wait_set_,
+          &WAIT_TIMEOUT))
+      {
+        return false;
+      }
+
+      const size_t pending_before_wait = pending;
+      for (size_t i = 0U; i < count; ++i) {
+        if (!ready_[i]) {
+          continue;
+        }
+        auto index = ready_index_[i];
+        bool taken = true;
+        while (taken && taken_[index] < messages) {
+          if (!take(subscriptions_[index], loaned, taken)) {
+            return false;
+          }
+          if (taken) {
+            ++taken_[index];
+            --pending;
+          }
+        }
+      }
+      // nothing arrived within the wait timeout
+      if (pending == pending_before_wait) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void report_throughput(benchmark::State & st, size_t payload_size, size_t messages)
+  {
+    const auto published = static_cast<int64_t>(st.iterations()) * static_cast<int64_t>(messages);
+    st.SetItemsProcessed(published);
+    st.SetBytesProcessed(published * static_cast<int64_t>(payload_size));
+  }
+
+  void report(benchmark::State & st, size_t payload_size)
+  {
+    report_throughput(st, payload_size, 1U);
+    latencies_.report(st);
+  }
+
+  rmw_publisher_t * publisher_{nullptr};
+  BenchmarkLatencies latencies_;
+
+private:
+  bool take(const rmw_subscription_t * subscription, bool loaned, bool & taken)
+  {
+    if (!loaned) {
+      return RMW_RET_OK == rmw_take(subscription, &received_, &taken, nullptr);
+    }
+    void * loaned_message = nullptr;
+    if (RMW_RET_OK != rmw_take_loaned_message(subscription, &loaned_message, &taken, nullptr)) {
+      return false;
+    }
+    return !taken ||
+           RMW_RET_OK == rmw_return_loaned_message_from_subscription(subscription, loaned_message);
+  }
+
+  std::vector<rmw_subscription_t *> subscriptions_;
+  rmw_wait_set_t * wait_set_{nullptr};
+  std::vector<void *> ready_;
+  std::vector<size_t> ready_index_;
+  std::vector<size_t> taken_;
+  MessageT received_;
+};
+
+using FixedSizePubSubPerformanceTest = PubSubPerformanceTest<test_msgs::msg::BasicTypes>;
+using VariableSizePubSubPerformanceTest =
+  PubSubPerformanceTest<test_msgs::msg::UnboundedSequences>;
+
+// a fixed size message is copied into a chunk on publish and out of it on take
+BENCHMARK_DEFINE_F(FixedSizePubSubPerformanceTest, copied)(benchmark::State & st)
+{
+  test_msgs::msg::BasicTypes message;
+  reset_heap_counters();
+  for (auto _ : st) {
+    auto start = std::chrono::steady_clock::now();
+    ++message.int32_value;
+    if (RMW_RET_OK != rmw_publish(publisher_, &message, nullptr)) {
+      st.SkipWithError(rmw_get_error_string().str);
+      break;
+    }
+    if (!take_from_all(false)) {
+      st.SkipWithError("a subscription did not receive the message");
+      break;
+    }
+    latencies_.record(start);
+  }
+  report(st, sizeof(message));
+}
+BENCHMARK_REGISTER_F(FixedSizePubSubPerformanceTest, copied)->Apply(subscription_args);
+
+// the publisher runs ahead of the subscriptions by PIPELINE_DEPTH copied messages
+BENCHMARK_DEFINE_F(FixedSizePubSubPerformanceTest, copied_pipelined)(benchmark::State & st)
+{
+  test_msgs::msg::BasicTypes message;
+  reset_heap_counters();
+  for (auto _ : st) {
+    for (size_t i = 0U; i < PIPELINE_DEPTH; ++i) {
+      ++message.int32_value;
+      if (RMW_RET_OK != rmw_publish(publisher_, &message, nullptr)) {
+        st.SkipWithError(rmw_get_error_string().str);
+        return;
+      }
+    }
+    if (!take_from_all(false, PIPELINE_DEPTH)) {
+      st.SkipWithError("a subscription did not receive the messages");
+      return;
+    }
+  }
+  report_throughput(st, sizeof(message), PIPELINE_DEPTH);
+}
+BENCHMARK_REGISTER_F(FixedSizePubSubPerformanceTest, copied_pipelined)
+->Apply(subscription_args);
+
+// a fixed size message is written into the chunk and read from it, without any copy
+BENCHMARK_DEFINE_F(FixedSizePubSubPerformanceTest, loaned)(benchmark::State & st)
+{
+  auto ts = rosidl_typesupport_cpp::get_message_type_support_handle<test_msgs::msg::BasicTypes>();
+  int32_t value = 0;
+  reset_heap_counters();
+  for (auto _ : st) {
+    auto start = std::chrono::steady_clock::now();
+    void * loaned_message = nullptr;
+    if (RMW_RET_OK != rmw_borrow_loaned_message(publisher_, ts, &loaned_message)) {
+      st.SkipWithError(rmw_get_error_string().str);
+      break;
+    }
+    static_cast<test_msgs::msg::BasicTypes *>(loaned_message)->int32_value = ++value;
+    if (RMW_RET_OK != rmw_publish_loaned_message(publisher_, loaned_message, nullptr)) {
+      st.SkipWithError(rmw_get_error_string().str);
+      break;
+    }
+    if (!take_from_all(true)) {
+      st.SkipWithError("a subscription did not receive the message");
+      break;
+    }
+    latencies_.record(start);
+  }
+  report(st, sizeof(test_msgs::msg::BasicTypes));
+}
+BENCHMARK_REGISTER_F(FixedSizePubSubPerformanceTest, loaned)->Apply(subscription_args);
+
+// a variable size message is serialized into a chunk on publish and deserialized on take,
+// range(1) is the size of its payload
+BENCHMARK_DEFINE_F(VariableSizePubSubPerformanceTest, copied)(benchmark::State & st)
+{
+  const auto payload_size = static_cast<size_t>(st.range(1));
+  test_msgs::msg::UnboundedSequences message;
+  message.uint8_values.resize(payload_size);
+  reset_heap_counters();
+  for (auto _ : st) {
+    auto start = std::chrono::steady_clock::now();
+    ++message.uint8_values[0];
+    if (RMW_RET_OK != rmw_publish(publisher_, &message, nullptr)) {
+      st.SkipWithError(rmw_get_error_string().str);
+      break;
+    }
+    if (!take_from_all(false)) {
+      st.SkipWithError("a subscription did not receive the message");
+      break;
+    }
+    latencies_.record(start);
+  }
+  report(st, payload_size);
+}
+BENCHMARK_REGISTER_F(VariableSizePubSubPerformanceTest, copied)
+->Apply(subscription_and_payload_args);
+
+// the publisher runs ahead of the subscriptions by PIPELINE_DEPTH serialized messages
+BENCHMARK_DEFINE_F(VariableSizePubSubPerformanceTest, copied_pipelined)(benchmark::State & st)
+{
+  const auto payload_size = static_cast<size_t>(st.range(1));
+  test_msgs::msg::UnboundedSequences message;
+  message.uint8_values.resize(payload_size);
+  reset_heap_counters();
+  for (auto _ : st) {
+    for (size_t i = 0U; i < PIPELINE_DEPTH; ++i) {
+      ++message.uint8_values[0];
+      if (RMW_RET_OK != rmw_publish(publisher_, &message, nullptr)) {
+        st.SkipWithError(rmw_get_error_string().str);
+        return;
+      }
+    }
+    if (!take_from_all(false, PIPELINE_DEPTH)) {
+      st.SkipWithError("a subscription did not receive the messages");
+      return;
+    }
+  }
+  report_throughput(st, payload_size, PIPELINE_DEPTH);
+}
+BENCHMARK_REGISTER_F(VariableSizePubSubPerformanceTest, copied_pipelined)
+->Apply(subscription_and_payload_args);
@@ -0,0 +1,325 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcutils/allocator.h"
+
+#include "rmw/rmw.h"
+#include "rmw/serialized_message.h"
+
+#include "rosidl_typesupport_cpp/message_type_support.hpp"
+
+#include "rmw_iceoryx_cpp/iceoryx_deserialize.hpp"
+#include "rmw_iceoryx_cpp/iceoryx_serialize.hpp"
+
+#include "test_msgs/message_fixtures.hpp"
+
+#include "../test_msgs_c_fixtures.hpp"
+
+using performance_test_fixture::PerformanceTest;
+
+namespace
+{
+template<typename MessageT>
+using Messages = std::vector<std::shared_ptr<MessageT>>;
+
+constexpr size_t LARGE_BYTE_SEQUENCE_SIZE{1024U * 1024U};
+constexpr size_t LARGE_STRUCT_SEQUENCE_SIZE{100000U};
+constexpr size_t SMALL_STRINGS_COUNT{10000U};
+
+// a 1 MiB blob like an image or a point cloud
+Messages<test_msgs::msg::UnboundedSequences> get_messages_large_byte_sequence()
+{
+  auto message = std::make_shared<test_msgs::msg::UnboundedSequences>();
+  message->uint8_values.resize(LARGE_BYTE_SEQUENCE_SIZE, 0xAB);
+  return {message};
+}
+
+// a large sequence of small fixed size structs like geometry_msgs/Point[], which is not
+// available to the tests, hence test_msgs/BasicTypes stands in for it
+Messages<test_msgs::msg::UnboundedSequences> get_messages_large_struct_sequence()
+{
+  auto message = std::make_shared<test_msgs::msg::UnboundedSequences>();
+  message->basic_types_values.resize(LARGE_STRUCT_SEQUENCE_SIZE);
+  for (size_t i = 0U; i < LARGE_STRUCT_SEQUENCE_SIZE; ++i) {
+    message->basic_types_values[i].float64_value = static_cast<double>(i);
+  }
+  return {message};
+}
+
+// many short strings like the names in a diagnostics or parameter message
+Messages<test_msgs::msg::UnboundedSequences> get_messages_many_small_strings()
+{
+  auto message = std::make_shared<test_msgs::msg::UnboundedSequences>();
+  message->string_values.reserve(SMALL_STRINGS_COUNT);
+  for (size_t i = 0U; i < SMALL_STRINGS_COUNT; ++i) {
+    message->string_values.push_back("string_" + std::to_string(i));
+  }
+  return {message};
+}
+}  // namespace
+
+/// @brief Serializes and deserializes all messages of a fixture once per iteration, with the
+///        buffers and the target message allocated up front like on the publish and take path.
+///        The C deserializer allocates fresh sequences, hence a C message is reset with fini
+///        and init after every deserialization, which is part of the measurement.
+class SerializationPerformanceTest : public PerformanceTest
+{
+protected:
+  template<typename MessageT>
+  void serialize_messages(
+    benchmark::State & st,
+    const rosidl_message_type_support_t * ts,
+    const Messages<MessageT> & messages)
+  {
+    size_t max_size = 0U;
+    for (auto & message : messages) {
+      max_size = std::max(max_size, rmw_iceoryx_cpp::get_serialized_size(message.get(), ts));
+    }
+    std::vector<char> buffer(max_size);
+
+    reset_heap_counters();
+    size_t bytes = 0U;
+    for (auto _ : st) {
+      for (auto & message : messages) {
+        auto size = rmw_iceoryx_cpp::get_serialized_size(message.get(), ts);
+        rmw_iceoryx_cpp::serialize(message.get(), ts, buffer.data(), size);
+        bytes += size;
+      }
+      benchmark::DoNotOptimize(buffer.data());
+      benchmark::ClobberMemory();
+    }
+    set_processed(st, messages.size(), bytes);
+  }
+
+  template<typename MessageT>
+  void rmw_serialize_messages(
+    benchmark::State & st,
+    const rosidl_message_type_support_t * ts,
+    const Messages<MessageT> & messages)
+  {
+    rcutils_allocator_t allocator = rcutils_get_default_allocator();
+    rmw_serialized_message_t serialized_message = rmw_get_zero_initialized_serialized_message();
+    if (RMW_RET_OK != rmw_serialized_message_init(&serialized_message, 0U, &allocator)) {
+      st.SkipWithError("rmw_serialized_message_init failed");
+      return;
+    }
+    // the first round grows the buffer to the largest message
+    for (auto & message : messages) {
+      (void)rmw_serialize(message.get(), ts, &serialized_message);
+    }
+
+    reset_heap_counters();
+    size_t bytes = 0U;
+    for (auto _ : st) {
+      for (auto & message : messages) {
+        if (RMW_RET_OK != rmw_serialize(message.get(), ts, &serialized_message)) {
+          st.SkipWithError("rmw_serialize failed");
+          break;
+        }
+        bytes += serialized_message.buffer_length;
+      }
+      benchmark::ClobberMemory();
+    }
+    set_processed(st, messages.size(), bytes);
+
+    (void)rmw_serialized_message_fini(&serialized_message);
+  }
+
+  template<typename MessageT, typename InitF, typename FiniF>
+  void deserialize_messages(
+    benchmark::State & st,
+    const rosidl_message_type_support_t * ts,
+    const Messages<MessageT> & messages,
+    InitF init,
+    FiniF fini)
+  {
+    std::vector<std::vector<char>> payloads;
+    for (auto & message : messages) {
+      payloads.emplace_back();
+      rmw_iceoryx_cpp::serialize(message.get(), ts, payloads.back());
+    }
+    MessageT message{};
+    init(&message);
+
+    reset_heap_counters();
+    size_t bytes = 0U;
+    for (auto _ : st) {
+      for (auto & payload : payloads) {
+        rmw_iceoryx_cpp::deserialize(payload.data(), ts, &message);
+        fini(&message);
+        init(&message);
+        bytes += payload.size();
+      }
+      benchmark::ClobberMemory();
+    }
+    set_processed(st, payloads.size(), bytes);
+
+    fini(&message);
+  }
+
+  template<typename MessageT, typename InitF, typename FiniF>
+  void rmw_deserialize_messages(
+    benchmark::State & st,
+    const rosidl_message_type_support_t * ts,
+    const Messages<MessageT> & messages,
+    InitF init,
+    FiniF fini)
+  {
+    rcutils_allocator_t allocator = rcutils_get_default_allocator();
+    std::vector<rmw_serialized_message_t> serialized_messages;
+    for (auto & message : messages) {
+      serialized_messages.push_back(rmw_get_zero_initialized_serialized_message());
+      if (RMW_RET_OK != rmw_serialized_message_init(&serialized_messages.back(), 0U, &allocator) ||
+        RMW_RET_OK != rmw_serialize(message.get(), ts, &serialized_messages.back()))
+      {
+        st.SkipWithError("preparing the serialized messages failed");
+        fini_serialized_messages(serialized_messages);
+        return;
+      }
+    }
+    MessageT message{};
+    init(&message);
+
+    reset_heap_counters();
+    size_t bytes = 0U;
+    for (auto _ : st) {
+      for (auto & serialized_message : serialized_messages) {
+        if (RMW_RET_OK != rmw_deserialize(&serialized_message, ts, &message)) {
+          st.SkipWithError("rmw_deserialize failed");
+          break;
+        }
+        fini(&message);
+        init(&message);
+        bytes += serialized_message.buffer_length;
+      }
+      benchmark::ClobberMemory();
+    }
+    set_processed(st, serialized_messages.size(), bytes);
+
+    fini(&message);
+    fini_serialized_messages(serialized_messages);
+  }
+
+private:
+  static void set_processed(benchmark::State & st, size_t messages, size_t bytes)
+  {
+    st.SetItemsProcessed(static_cast<int64_t>(st.iterations() * messages));
+    st.SetBytesProcessed(static_cast<int64_t>(bytes));
+  }
+
+  static void fini_serialized_messages(std::vector<rmw_serialized_message_t> & messages)
+  {
+    for (auto & message : messages) {
+      (void)rmw_serialized_message_fini(&message);
+    }
+  }
+};
+
+// C++ messages are constructed and destructed, hence there is nothing to reset
+#define CPP_SERIALIZATION_BENCHMARKS(Type, fixture) \
+  BENCHMARK_F(SerializationPerformanceTest, cpp_ ## fixture ## _serialize) \
+    (benchmark::State & st) \
+  { \
+    serialize_messages( \
+      st, rosidl_typesupport_cpp::get_message_type_support_handle<test_msgs::msg::Type>(), \
+      get_messages_ ## fixture()); \
+  } \
+  BENCHMARK_F(SerializationPerformanceTest, cpp_ ## fixture ## _deserialize) \
+    (benchmark::State & st) \
+  { \
+    deserialize_messages( \
+      st, rosidl_typesupport_cpp::get_message_type_support_handle<test_msgs::msg::Type>(), \
+      get_messages_ ## fixture(), [](test_msgs::msg::Type *) {}, [](test_msgs::msg::Type *) {}); \
+  } \
+  BENCHMARK_F(SerializationPerformanceTest, cpp_ ## fixture ## _rmw_serialize) \
+    (benchmark::State & st) \
+  { \
+    rmw_serialize_messages( \
+      st, rosidl_typesupport_cpp::get_message_type_support_handle<test_msgs::msg::Type>(), \
+      get_messages_ ## fixture()); \
+  } \
+  BENCHMARK_F(SerializationPerformanceTest, cpp_ ## fixture ## _rmw_deserialize) \
+    (benchmark::State & st) \
+  { \
+    rmw_deserialize_messages( \
+      st, rosidl_typesupport_cpp::get_message_type_support_handle<test_msgs::msg::Type>(), \
+      get_messages_ ## fixture(), [](test_msgs::msg::Type *) {}, [](test_msgs::msg::Type *) {}); \
+  }
+
+#define C_SERIALIZATION_BENCHMARKS(Type, fixture) \
+  BENCHMARK_F(SerializationPerformanceTest, c_ ## fixture ## _serialize) \
+    (benchmark::State & st) \
+  { \
+    serialize_messages( \
+      st, ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, Type), get_messages_ ## fixture ## _c()); \
+  } \
+  BENCHMARK_F(SerializationPerformanceTest, c_ ## fixture ## _deserialize) \
+    (benchmark::State & st) \
+  { \
+    deserialize_messages( \
+      st, ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, Type), get_messages_ ## fixture ## _c(), \
+      [](test_msgs__msg__ ## Type * msg) {(void)test_msgs__msg__ ## Type ## __init(msg);}, \
+      [](test_msgs__msg__ ## Type * msg) {test_msgs__msg__ ## Type ## __fini(msg);}); \
+  } \
+  BENCHMARK_F(SerializationPerformanceTest, c_ ## fixture ## _rmw_serialize) \
+    (benchmark::State & st) \
+  { \
+    rmw_serialize_messages( \
+      st, ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, Type), get_messages_ ## fixture ## _c()); \
+  } \
+  BENCHMARK_F(SerializationPerformanceTest, c_ ## fixture ## _rmw_deserialize) \
+    (benchmark::State & st) \
+  { \
+    rmw_deserialize_messages( \
+      st, ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, Type), get_messages_ ## fixture ## _c(), \
+      [](test_msgs__msg__ ## Type * msg) {(void)test_msgs__msg__ ## Type ## __init(msg);}, \
+      [](test_msgs__msg__ ## Type * msg) {test_msgs__msg__ ## Type ## __fini(msg);}); \
+  }
+
+CPP_SERIALIZATION_BENCHMARKS(Empty, empty)
+CPP_SERIALIZATION_BENCHMARKS(BasicTypes, basic_types)
+CPP_SERIALIZATION_BENCHMARKS(Constants, constants)
+CPP_SERIALIZATION_BENCHMARKS(Defaults, defaults)
+CPP_SERIALIZATION_BENCHMARKS(Strings, strings)
+CPP_SERIALIZATION_BENCHMARKS(Arrays, arrays)
+CPP_SERIALIZATION_BENCHMARKS(UnboundedSequences, unbounded_sequences)
+CPP_SERIALIZATION_BENCHMARKS(BoundedSequences, bounded_sequences)
+CPP_SERIALIZATION_BENCHMARKS(MultiNested, multi_nested)
+CPP_SERIALIZATION_BENCHMARKS(Nested, nested)
+CPP_SERIALIZATION_BENCHMARKS(Builtins, builtins)
+// wstrings are left out like in iceoryx_serialization_test
+
+CPP_SERIALIZATION_BENCHMARKS(UnboundedSequences, large_byte_sequence)
+CPP_SERIALIZATION_BENCHMARKS(UnboundedSequences, large_struct_sequence)
+CPP_SERIALIZATION_BENCHMARKS(UnboundedSequences, many_small_strings)
+
+C_SERIALIZATION_BENCHMARKS(Empty, empty)
+C_SERIALIZATION_BENCHMARKS(BasicTypes, basic_types)
+C_SERIALIZATION_BENCHMARKS(Constants, constants)
+C_SERIALIZATION_BENCHMARKS(Defaults, defaults)
+C_SERIALIZATION_BENCHMARKS(Strings, strings)
+C_SERIALIZATION_BENCHMARKS(Arrays, arrays)
+C_SERIALIZATION_BENCHMARKS(UnboundedSequences, unbounded_sequences)
+C_SERIALIZATION_BENCHMARKS(BoundedSequences, bounded_sequences)
+C_SERIALIZATION_BENCHMARKS(Nested, nested)
+C_SERIALIZATION_BENCHMARKS(Builtins, builtins)
+// multi nested C messages are left out like in iceoryx_serialization_test
@@ -0,0 +1,376 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rmw/error_handling.h"
+#include "rmw/rmw.h"
+
+#include "rosidl_typesupport_cpp/message_type_support.hpp"
+#include "rosidl_typesupport_cpp/service_type_support.hpp"
+
+#include "test_msgs/msg/basic_types.hpp"
+#include "test_msgs/srv/basic_types.hpp"
+
+#include "../benchmark_latencies.hpp"
+#include "../rmw_roudi_environment.hpp"
+
+using performance_test_fixture::PerformanceTest;
+
+namespace
+{
+const std::vector<int64_t> ENTITY_COUNTS{1, 10, 100, 1000, 2000};
+const std::vector<int64_t> READY_PERCENTAGES{0, 10, 100};
+
+void entity_and_ready_args(benchmark::internal::Benchmark * b)
+{
+  for (auto entities : ENTITY_COUNTS) {
+    for (auto ready_percentage : READY_PERCENTAGES) {
+      b->Args({entities, ready_percentage});
+    }
+  }
+}
+}  // namespace
+
+/// @brief Calls rmw_wait on range(0) entities of one kind of which range(1) percent are ready.
+///        The number of entities is capped by the capacity of the iceoryx WaitSet and reported
+///        as 'entities'. Ready subscriptions, services and clients stay ready as nothing is
+///        taken, ready guard conditions are triggered again before every call, like the
+///        interrupt guard condition of an executor. With no entity ready rmw_wait is called with
+///        a zero timeout, hence every run measures the cost of the call and not the timeout.
+class WaitPerformanceTest : public PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & st) override
+  {
+    entities_ = std::min<size_t>(
+      static_cast<size_t>(st.range(0)), iox::MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET);
+    ready_ = entities_ * static_cast<size_t>(st.range(1)) / 100U;
+
+    name_prefix_ = unique_run_name("/benchmark_wait_");
+
+    wait_set_ = rmw_create_wait_set(RmwRouDiEnvironment::instance().context(), entities_);
+    if (!wait_set_) {
+      st.SkipWithError(rmw_get_error_string().str);
+    }
+    st.counters["entities"] = static_cast<double>(entities_);
+    st.counters["ready"] = static_cast<double>(ready_);
+
+    PerformanceTest::SetUp(st);
+  }
+
+  void TearDown(benchmark::State & st) override
+  {
+    PerformanceTest::TearDown(st);
+
+    auto node = RmwRouDiEnvironment::instance().node();
+    for (auto subscription : subscriptions_) {
+      (void)rmw_destroy_subscription(node, subscription);
+    }
+    for (auto publisher : publishers_) {
+      (void)rmw_destroy_publisher(node, publisher);
+    }
+    for (auto service : services_) {
+      (void)rmw_destroy_service(node, service);
+    }
+    for (auto client : clients_) {
+      (void)rmw_destroy_client(node, client);
+    }
+    for (auto guard_condition : guard_conditions_) {
+      (void)rmw_destroy_guard_condition(guard_condition);
+    }
+    subscriptions_.clear();
+    publishers_.clear();
+    services_.clear();
+    clients_.clear();
+    guard_conditions_.clear();
+    subscription_handles_.clear();
+    service_handles_.clear();
+    client_handles_.clear();
+    guard_condition_handles_.clear();
+    triggered_guard_conditions_ = 0U;
+    if (wait_set_) {
+      (void)rmw_destroy_wait_set(wait_set_);
+      wait_set_ = nullptr;
+    }
+    latencies_.clear();
+  }
+
+protected:
+  /// @brief The ready subscriptions are on a topic with one sample, the others on a topic
+  ///        nobody publishes to
+  bool create_subscriptions()
+  {
+    auto & environment = RmwRouDiEnvironment::instance();
+    auto ts = rosidl_typesupport_cpp::get_message_type_support_handle<
+      test_msgs::msg::BasicTypes>();
+    const auto ready_topic = name_prefix_ + "_ready";
+    const auto idle_topic = name_prefix_ + "_idle";
+
+    auto subscription_options = rmw_get_default_subscription_options();
+    for (size_t i = 0U; i < entities_; ++i) {
+      const auto & topic = (i < ready_) ? ready_topic : idle_topic;
+      auto subscription = rmw_create_subscription(
+        environment.node(), ts, topic.c_str(), &rmw_qos_profile_default, &subscription_options);
+      if (!subscription) {
+        return false;
+      }
+      subscriptions_.push_back(subscription);
+      subscription_handles_.push_back(subscription->data);
+    }
+    if (ready_ == 0U) {
+      return true;
+    }
+
+    auto publisher_options = rmw_get_default_publisher_options();
+    auto publisher = rmw_create_publisher(
+      environment.node(), ts, ready_topic.c_str(), &rmw_qos_profile_default, &publisher_options);
+    if (!publisher) {
+      return false;
+    }
+    publishers_.push_back(publisher);
+    environment.discover();
+    test_msgs::msg::BasicTypes message;
+    return RMW_RET_OK == rmw_publish(publisher, &message, nullptr);
+  }
+
+  /// @brief Every ready service has a client which sent one request
+  bool create_services()
+  {
+    auto & environment = RmwRouDiEnvironment::instance();
+    auto ts = rosidl_typesupport_cpp::get_service_type_support_handle<
+      test_msgs::srv::BasicTypes>();
+
+    for (size_t i = 0U; i < entities_; ++i) {
+      const auto service_name = name_prefix_ + "_" + std::to_string(i);
+      auto service = rmw_create_service(
+        environment.node(), ts, service_name.c_str(), &rmw_qos_profile_services_default);
+      if (!service) {
+        return false;
+      }
+      services_.push_back(service);
+      service_handles_.push_back(service->data);
+      if (i < ready_) {
+        auto client = rmw_create_client(
+          environment.node(), ts, service_name.c_str(), &rmw_qos_profile_services_default);
+        if (!client) {
+          return false;
+        }
+        clients_.push_back(client);
+      }
+    }
+    environment.discover();
+
+    test_msgs::srv::BasicTypes::Request request;
+    for (auto client : clients_) {
+      int64_t sequence_id = 0;
+      if (RMW_RET_OK != rmw_send_request(client, &request, &sequence_id)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// @brief Every ready client has a server which answered its request
+  bool create_clients()
+  {
+    auto & environment = RmwRouDiEnvironment::instance();
+    auto ts = rosidl_typesupport_cpp::get_service_type_support_handle<
+      test_msgs::srv::BasicTypes>();
+
+    for (size_t i = 0U; i < entities_; ++i) {
+      const auto service_name = name_prefix_ + "_" + std::to_string(i);
+      auto client = rmw_create_client(
+        environment.node(), ts, service_name.c_str(), &rmw_qos_profile_services_default);
+      if (!client) {
+        return false;
+      }
+      clients_.push_back(client);
+      client_handles_.push_back(client->data);
+      if (i < ready_) {
+        auto service = rmw_create_service(
+          environment.node(), ts, service_name.c_str(), &rmw_qos_profile_services_default);
+        if (!service) {
+          return false;
+        }
+        services_.push_back(service);
+      }
+    }
+    environment.discover();
+
+    test_msgs::srv::BasicTypes::Request request;
+    test_msgs::srv::BasicTypes::Response response;
+    for (size_t i = 0U; i < ready_; ++i) {
+      int64_t sequence_id = 0;
+      if (RMW_RET_OK != rmw_send_request(clients_[i], &request, &sequence_id)) {
+        return false;
+      }
+      if (RMW_RET_OK != RmwRouDiEnvironment::wait_for(wait_set_, services_[i])) {
+        return false;
+      }
+      rmw_service_info_t request_header;
+      bool taken = false;
+      if (RMW_RET_OK != rmw_take_request(services_[i], &request_header, &request, &taken) ||
+        !taken ||
+        RMW_RET_OK != rmw_send_response(services_[i], &request_header.request_id, &response))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool create_guard_conditions()
+  {
+    auto context = RmwRouDiEnvironment::instance().context();
+    for (size_t i = 0U; i < entities_; ++i) {
+      auto guard_condition = rmw_create_guard_condition(context);
+      if (!guard_condition) {
+        return false;
+      }
+      guard_conditions_.push_back(guard_condition);
+      guard_condition_handles_.push_back(guard_condition->data);
+    }
+    triggered_guard_conditions_ = ready_;
+    return true;
+  }
+
+  void run(benchmark::State & st)
+  {
+    // rmw_wait overwrites the entities which are not ready, hence it gets a copy every call
+    std::vector<void *> subscriptions(subscription_handles_.size());
+    std::vector<void *> services(service_handles_.size());
+    std::vector<void *> clients(client_handles_.size());
+    std::vector<void *> guard_conditions(guard_condition_handles_.size());
+    rmw_subscriptions_t wait_subscriptions{subscriptions.size(), subscriptions.data()};
+    rmw_services_t wait_services{services.size(), services.data()};
+    rmw_clients_t wait_clients{clients.size(), clients.data()};
+    rmw_guard_conditions_t wait_guard_conditions{
+      guard_conditions.size(), guard_conditions.data()};
+    rmw_events_t wait_events{0U, nullptr};
+    const rmw_time_t timeout = (ready_ > 0U) ? rmw_time_t{1U, 0U} : rmw_time_t{0U, 0U};
+
+    auto wait = [&]() {
+        for (size_t i = 0U; i < triggered_guard_conditions_; ++i) {
+          (void)rmw_trigger_guard_condition(guard_conditions_[i]);
+        }
+        std::copy(
+          subscription_handles_.begin(), subscription_handles_.end(), subscriptions.begin());
+        std::copy(service_handles_.begin(), service_handles_.end(), services.begin());
+        std::copy(client_handles_.begin(), client_handles_.end(), clients.begin());
+        std::copy(
+          guard_condition_handles_.begin(), guard_condition_handles_.end(),
+          guard_conditions.begin());
+        return rmw_wait(
+          &wait_subscriptions, &wait_guard_conditions, &wait_services, &wait_clients,
+          &wait_events, wait_set_, &timeout);
+      };
+
+    // a first call checks that exactly the expected entities are ready
+    if (RMW_RET_OK != wait()) {
+      st.SkipWithError(rmw_get_error_string().str);
+      return;
+    }
+    auto is_ready = [](void * handle) {return handle != nullptr;};
+    const auto ready = static_cast<size_t>(
+      std::count_if(subscriptions.begin(), subscriptions.end(), is_ready) +
+      std::count_if(services.begin(), services.end(), is_ready) +
+      std::count_if(clients.begin(), clients.end(), is_ready) +
+      std::count_if(guard_conditions.begin(), guard_conditions.end(), is_ready));
+    if (ready != ready_) {
+      st.SkipWithError("unexpected number of ready entities");
+      return;
+    }
+
+    reset_heap_counters();
+    for (auto _ : st) {
+      auto start = std::chrono::steady_clock::now();
+      if (RMW_RET_OK != wait()) {
+        st.SkipWithError(rmw_get_error_string().str);
+        break;
+      }
+      latencies_.record(start);
+    }
+    latencies_.report(st);
+  }
+
+private:
+  size_t entities_{0U};
+  size_t ready_{0U};
+  std::string name_prefix_;
+  rmw_wait_set_t * wait_set_{nullptr};
+
+  std::vector<rmw_subscription_t *> subscriptions_;
+  std::vector<rmw_publisher_t *> publishers_;
+  std::vector<rmw_service_t *> services_;
+  std::vector<rmw_client_t *> clients_;
+  std::vector<rmw_guard_condition_t *> guard_conditions_;
+  size_t triggered_guard_conditions_{0U};
+
+  // the handles which are passed to rmw_wait
+  std::vector<void *> subscription_handles_;
+  std::vector<void *> service_handles_;
+  std::vector<void *> client_handles_;
+  std::vector<void *> guard_condition_handles_;
+
+  BenchmarkLatencies latencies_;
+};
+
+BENCHMARK_DEFINE_F(WaitPerformanceTest, subscriptions)(benchmark::State & st)
+{
+  if (!create_subscriptions()) {
+    st.SkipWithError(rmw_get_error_string().str);
+    return;
+  }
+  run(st);
+}
+BENCHMARK_REGISTER_F(WaitPerformanceTest, subscriptions)->Apply(entity_and_ready_args);
+
+BENCHMARK_DEFINE_F(WaitPerformanceTest, services)(benchmark::State & st)
+{
+  if (!create_services()) {
+    st.SkipWithError(rmw_get_error_string().str);
+    return;
+  }
+  run(st);
+}
+BENCHMARK_REGISTER_F(WaitPerformanceTest, services)->Apply(entity_and_ready_args);
+
+BENCHMARK_DEFINE_F(WaitPerformanceTest, clients)(benchmark::State & st)
+{
+  if (!create_clients()) {
+    st.SkipWithError(rmw_get_error_string().str);
+    return;
+  }
+  run(st);
+}
+BENCHMARK_REGISTER_F(WaitPerformanceTest, clients)->Apply(entity_and_ready_args);
+
+BENCHMARK_DEFINE_F(WaitPerformanceTest, guard_conditions)(benchmark::State & st)
+{
+  if (!create_guard_conditions()) {
+    st.SkipWithError(rmw_get_error_string().str);
+    return;
+  }
+  run(st);
+}
+BENCHMARK_REGISTER_F(WaitPerformanceTest, guard_conditions)->Apply(entity_and_ready_args);
@@ -0,0 +1,86 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BENCHMARK_LATENCIES_HPP_
+#define BENCHMARK_LATENCIES_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+/// @brief A name which no previous run of the benchmark used, hence no sample of a previous
+///        run is received on a topic or service of this name
+inline std::string unique_run_name(const std::string & prefix)
+{
+  static size_t run{0U};
+  return prefix + std::to_string(run++);
+}
+
+/// @brief Records the latency of every iteration of a run and reports its percentiles as the
+///        counters 'p50_us', 'p99_us' and 'p99.9_us'
+class BenchmarkLatencies
+{
+public:
+  /// @brief Enough for a few seconds of iterations, reserved up front so that recording a
+  ///        latency never allocates
+  static constexpr size_t MAX_SAMPLES{1000000U};
+
+  BenchmarkLatencies()
+  {
+    latencies_ns_.reserve(MAX_SAMPLES);
+  }
+
+  /// @brief Record the time since 'start', samples beyond MAX_SAMPLES are dropped
+  void record(std::chrono::steady_clock::time_point start)
+  {
+    if (latencies_ns_.size() < latencies_ns_.capacity()) {
+      latencies_ns_.push_back(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start).count());
+    }
+  }
+
+  void report(benchmark::State & st)
+  {
+    st.counters["p50_us"] = percentile_us(0.5);
+    st.counters["p99_us"] = percentile_us(0.99);
+    st.counters["p99.9_us"] = percentile_us(0.999);
+  }
+
+  void clear()
+  {
+    latencies_ns_.clear();
+  }
+
+private:
+  double percentile_us(double percentile)
+  {
+    if (latencies_ns_.empty()) {
+      return 0.0;
+    }
+    auto nth = latencies_ns_.begin() +
+      static_cast<std::ptrdiff_t>(percentile * static_cast<double>(latencies_ns_.size() - 1U));
+    std::nth_element(latencies_ns_.begin(), nth, latencies_ns_.end());
+    return static_cast<double>(*nth) / 1000.0;
+  }
+
+  std::vector<int64_t> latencies_ns_;
+};
+
+#endif  // BENCHMARK_LATENCIES_HPP_
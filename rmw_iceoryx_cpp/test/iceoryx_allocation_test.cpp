@@ -0,0 +1,285 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+#include "osrf_testing_tools_cpp/memory_tools/memory_tools.hpp"
+
+#include "rmw/error_handling.h"
+#include "rmw/rmw.h"
+
+#include "rosidl_typesupport_cpp/message_type_support.hpp"
+#include "rosidl_typesupport_cpp/service_type_support.hpp"
+
+#include "test_msgs/msg/basic_types.hpp"
+#include "test_msgs/msg/strings.hpp"
+#include "test_msgs/srv/arrays.hpp"
+#include "test_msgs/srv/empty.hpp"
+
+#include "./rmw_roudi_environment.hpp"
+
+namespace memory_tools = osrf_testing_tools_cpp::memory_tools;
+
+namespace
+{
+// the first rounds may allocate, e.g. for thread local error state or lazily grown buffers
+constexpr size_t WARM_UP_ROUNDS{10U};
+constexpr size_t MEASURED_ROUNDS{100U};
+// deserializing into a message which was taken before reuses its memory, a few allocations per
+// call are tolerated for strings which outgrow the small string buffer
+constexpr size_t MAX_VARIABLE_SIZE_ALLOCATIONS_PER_CALL{4U};
+
+/// @brief Heap operations of the calls of one rmw function, summed over the measured rounds
+struct HeapOperations
+{
+  size_t allocations_{0U};
+  size_t frees_{0U};
+};
+}  // namespace
+
+/// @brief Counts the heap operations of the calling thread while a call is monitored. The
+///        counting relies on the malloc interposition of memory_tools, the tests are skipped if
+///        it is not preloaded.
+class AllocationTest : public ::testing::Test
+{
+protected:
+  static void SetUpTestCase()
+  {
+    memory_tools::initialize();
+  }
+
+  static void TearDownTestCase()
+  {
+    memory_tools::uninitialize();
+  }
+
+  void SetUp() override
+  {
+    if (!memory_tools::is_working()) {
+      GTEST_SKIP() << "memory_tools is not preloaded, allocations can't be counted";
+    }
+    auto count_allocation = [this](memory_tools::MemoryToolsService & service) {
+        service.ignore();
+        ++current_.allocations_;
+      };
+    memory_tools::on_malloc(count_allocation);
+    memory_tools::on_calloc(count_allocation);
+    memory_tools::on_realloc(count_allocation);
+    memory_tools::on_free(
+      [this](memory_tools::MemoryToolsService & service) {
+        service.ignore();
+        ++current_.frees_;
+      });
+
+    // every test gets its own topic and service, hence no sample of another test is received
+    static size_t test{0U};
+    name_ = "/allocation_test_" + std::to_string(test++);
+  }
+
+  void TearDown() override
+  {
+    // the callbacks are only called while monitoring, the next test replaces them
+    memory_tools::disable_monitoring();
+  }
+
+  /// @brief Call 'function' and add its heap operations to 'operations' if 'measure' is set
+  template<typename FunctionT>
+  rmw_ret_t monitor(bool measure, HeapOperations & operations, FunctionT function)
+  {
+    if (!measure) {
+      return function();
+    }
+    current_ = HeapOperations{};
+    memory_tools::enable_monitoring();
+    auto ret = function();
+    memory_tools::disable_monitoring();
+    operations.allocations_ += current_.allocations_;
+    operations.frees_ += current_.frees_;
+    return ret;
+  }
+
+  /// @brief Publish, wait and take WARM_UP_ROUNDS + MEASURED_ROUNDS messages and count the heap
+  ///        operations of the measured rounds
+  template<typename MessageT>
+  void publish_wait_take(
+    MessageT & message,
+    HeapOperations & publish,
+    HeapOperations & wait,
+    HeapOperations & take)
+  {
+    auto & environment = RmwRouDiEnvironment::instance();
+    auto ts = rosidl_typesupport_cpp::get_message_type_support_handle<MessageT>();
+    auto publisher_options = rmw_get_default_publisher_options();
+    auto publisher = rmw_create_publisher(
+      environment.node(), ts, name_.c_str(), &rmw_qos_profile_default, &publisher_options);
+    ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+    auto subscription_options = rmw_get_default_subscription_options();
+    auto subscription = rmw_create_subscription(
+      environment.node(), ts, name_.c_str(), &rmw_qos_profile_default, &subscription_options);
+    ASSERT_NE(nullptr, subscription) << rmw_get_error_string().str;
+    auto wait_set = rmw_create_wait_set(environment.context(), 1U);
+    ASSERT_NE(nullptr, wait_set) << rmw_get_error_string().str;
+    environment.discover();
+
+    MessageT received;
+    for (size_t round = 0U; round < WARM_UP_ROUNDS + MEASURED_ROUNDS; ++round) {
+      const bool measure = round >= WARM_UP_ROUNDS;
+      ASSERT_EQ(
+        RMW_RET_OK,
+        monitor(measure, publish, [&]() {return rmw_publish(publisher, &message, nullptr);}));
+      ASSERT_EQ(
+        RMW_RET_OK,
+        monitor(
+          measure, wait,
+          [&]() {return RmwRouDiEnvironment::wait_for(wait_set, subscription);}));
+      bool taken = false;
+      ASSERT_EQ(
+        RMW_RET_OK,
+        monitor(
+          measure, take, [&]() {return rmw_take(subscription, &received, &taken, nullptr);}));
+      ASSERT_TRUE(taken);
+    }
+
+    EXPECT_EQ(RMW_RET_OK, rmw_destroy_wait_set(wait_set));
+    EXPECT_EQ(RMW_RET_OK, rmw_destroy_subscription(environment.node(), subscription));
+    EXPECT_EQ(RMW_RET_OK, rmw_destroy_publisher(environment.node(), publisher));
+  }
+
+  /// @brief Send, wait for and take WARM_UP_ROUNDS + MEASURED_ROUNDS responses and count the
+  ///        heap operations of the client in the measured rounds
+  template<typename ServiceT>
+  void send_request_take_response(
+    typename ServiceT::Request & request,
+    HeapOperations & send_request,
+    HeapOperations & wait,
+    HeapOperations & take_response)
+  {
+    auto & environment = RmwRouDiEnvironment::instance();
+    auto ts = rosidl_typesupport_cpp::get_service_type_support_handle<ServiceT>();
+    auto service = rmw_create_service(
+      environment.node(), ts, name_.c_str(), &rmw_qos_profile_services_default);
+    ASSERT_NE(nullptr, service) << rmw_get_error_string().str;
+    auto client = rmw_create_client(
+      environment.node(), ts, name_.c_str(), &rmw_qos_profile_services_default);
+    ASSERT_NE(nullptr, client) << rmw_get_error_string().str;
+    auto wait_set = rmw_create_wait_set(environment.context(), 1U);
+    ASSERT_NE(nullptr, wait_set) << rmw_get_error_string().str;
+    environment.discover();
+
+    typename ServiceT::Request received_request;
+    typename ServiceT::Response response;
+    for (size_t round = 0U; round < WARM_UP_ROUNDS + MEASURED_ROUNDS; ++round) {
+      const bool measure = round >= WARM_UP_ROUNDS;
+      int64_t sequence_id = 0;
+      ASSERT_EQ(
+        RMW_RET_OK,
+        monitor(
+          measure, send_request,
+          [&]() {return rmw_send_request(client, &request, &sequence_id);}));
+
+      // the server side is not part of the measurement
+      ASSERT_EQ(RMW_RET_OK, RmwRouDiEnvironment::wait_for(wait_set, service));
+      rmw_service_info_t request_header;
+      bool taken = false;
+      ASSERT_EQ(
+        RMW_RET_OK, rmw_take_request(service, &request_header, &received_request, &taken));
+      ASSERT_TRUE(taken);
+      ASSERT_EQ(RMW_RET_OK, rmw_send_response(service, &request_header.request_id, &response));
+
+      ASSERT_EQ(
+        RMW_RET_OK,
+        monitor(
+          measure, wait, [&]() {return RmwRouDiEnvironment::wait_for(wait_set, client);}));
+      rmw_service_info_t response_header;
+      taken = false;
+      ASSERT_EQ(
+        RMW_RET_OK,
+        monitor(
+          measure, take_response,
+          [&]() {return rmw_take_response(client, &response_header, &response, &taken);}));
+      ASSERT_TRUE(taken);
+      EXPECT_EQ(sequence_id, response_header.request_id.sequence_number);
+    }
+
+    EXPECT_EQ(RMW_RET_OK, rmw_destroy_wait_set(wait_set));
+    EXPECT_EQ(RMW_RET_OK, rmw_destroy_client(environment.node(), client));
+    EXPECT_EQ(RMW_RET_OK, rmw_destroy_service(environment.node(), service));
+  }
+
+  std::string name_;
+
+private:
+  HeapOperations current_;
+};
+
+TEST_F(AllocationTest, fixed_size_publish_wait_take_do_not_allocate)
+{
+  test_msgs::msg::BasicTypes message;
+  message.int32_value = 42;
+  HeapOperations publish, wait, take;
+  ASSERT_NO_FATAL_FAILURE(publish_wait_take(message, publish, wait, take));
+
+  EXPECT_EQ(0U, publish.allocations_);
+  EXPECT_EQ(0U, publish.frees_);
+  EXPECT_EQ(0U, wait.allocations_);
+  EXPECT_EQ(0U, wait.frees_);
+  EXPECT_EQ(0U, take.allocations_);
+  EXPECT_EQ(0U, take.frees_);
+}
+
+TEST_F(AllocationTest, fixed_size_send_request_take_response_do_not_allocate)
+{
+  test_msgs::srv::Empty::Request request;
+  HeapOperations send_request, wait, take_response;
+  ASSERT_NO_FATAL_FAILURE(
+    send_request_take_response<test_msgs::srv::Empty>(request, send_request, wait, take_response));
+
+  EXPECT_EQ(0U, send_request.allocations_);
+  EXPECT_EQ(0U, send_request.frees_);
+  EXPECT_EQ(0U, wait.allocations_);
+  EXPECT_EQ(0U, wait.frees_);
+  EXPECT_EQ(0U, take_response.allocations_);
+  EXPECT_EQ(0U, take_response.frees_);
+}
+
+TEST_F(AllocationTest, variable_size_publish_wait_take_allocations_are_bounded)
+{
+  test_msgs::msg::Strings message;
+  message.string_value = std::string(256U, 'x');
+  message.bounded_string_value = "bounded";
+  HeapOperations publish, wait, take;
+  ASSERT_NO_FATAL_FAILURE(publish_wait_take(message, publish, wait, take));
+
+  const auto max_allocations = MEASURED_ROUNDS * MAX_VARIABLE_SIZE_ALLOCATIONS_PER_CALL;
+  EXPECT_LE(publish.allocations_, max_allocations);
+  EXPECT_EQ(0U, wait.allocations_);
+  EXPECT_LE(take.allocations_, max_allocations);
+}
+
+TEST_F(AllocationTest, variable_size_send_request_take_response_allocations_are_bounded)
+{
+  test_msgs::srv::Arrays::Request request;
+  request.string_values[0] = std::string(256U, 'x');
+  HeapOperations send_request, wait, take_response;
+  ASSERT_NO_FATAL_FAILURE(
+    send_request_take_response<test_msgs::srv::Arrays>(request, send_request, wait, take_response));
+
+  const auto max_allocations = MEASURED_ROUNDS * MAX_VARIABLE_SIZE_ALLOCATIONS_PER_CALL;
+  EXPECT_LE(send_request.allocations_, max_allocations);
+  EXPECT_EQ(0U, wait.allocations_);
+  EXPECT_LE(take_response.allocations_, max_allocations);
+}
@@ -0,0 +1,216 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rmw_iceoryx_cpp/iceoryx_graph_cache.hpp"
+
+namespace
+{
+template<typename PortDataT>
+PortDataT make_port(const char * type, const char * topic, const char * node)
+{
+  PortDataT port;
+  port.m_caproServiceID = iox::capro::IdString_t(iox::cxx::TruncateToCapacity, type);
+  port.m_caproInstanceID = iox::capro::IdString_t(iox::cxx::TruncateToCapacity, topic);
+  port.m_caproEventMethodID = iox::capro::IdString_t(iox::cxx::TruncateToCapacity, "data");
+  port.m_node = iox::NodeName_t(iox::cxx::TruncateToCapacity, node);
+  return port;
+}
+}  // namespace
+
+class GraphCacheTest : public ::testing::Test
+{
+protected:
+  // the introspection sample is too large for the stack
+  std::unique_ptr<iox::roudi::PortIntrospectionFieldTopic> port_sample_{
+    new iox::roudi::PortIntrospectionFieldTopic()};
+};
+
+TEST_F(GraphCacheTest, empty_sample_yields_empty_snapshot)
+{
+  auto snapshot = rmw_iceoryx_cpp::build_graph_snapshot(*port_sample_);
+
+  EXPECT_EQ(0U, snapshot.generation_);
+  EXPECT_TRUE(snapshot.names_n_types_.empty());
+  EXPECT_TRUE(snapshot.publishers_topics_.empty());
+  EXPECT_TRUE(snapshot.subscribers_topics_.empty());
+  EXPECT_TRUE(snapshot.topic_publishers_.empty());
+  EXPECT_TRUE(snapshot.topic_subscribers_.empty());
+}
+
+TEST_F(GraphCacheTest, ports_are_indexed_by_node_and_by_topic)
+{
+  port_sample_->m_publisherList.push_back(
+    make_port<iox::roudi::PublisherPortData>("TypeA", "topic_a", "/ns/talker"));
+  port_sample_->m_publisherList.push_back(
+    make_port<iox::roudi::PublisherPortData>("TypeB", "topic_b", "/ns/talker"));
+  port_sample_->m_subscriberList.push_back(
+    make_port<iox::roudi::SubscriberPortData>("TypeA", "topic_a", "/ns/listener"));
+  port_sample_->m_subscriberList.push_back(
+    make_port<iox::roudi::SubscriberPortData>("TypeA", "topic_a", "/other"));
+
+  auto snapshot = rmw_iceoryx_cpp::build_graph_snapshot(*port_sample_);
+
+  ASSERT_EQ(2U, snapshot.names_n_types_.size());
+  EXPECT_EQ("TypeA", snapshot.names_n_types_.at("topic_a"));
+  EXPECT_EQ("TypeB", snapshot.names_n_types_.at("topic_b"));
+
+  EXPECT_EQ(
+    (std::vector<std::string>{"topic_a", "topic_b"}),
+    snapshot.publishers_topics_.at("/ns/talker"));
+  EXPECT_EQ(
+    (std::vector<std::string>{"topic_a"}), snapshot.subscribers_topics_.at("/ns/listener"));
+  EXPECT_EQ(
+    (std::vector<std::string>{"topic_a"}), snapshot.subscribers_topics_.at("/other"));
+
+  EXPECT_EQ(
+    (std::vector<std::string>{"/ns/talker"}), snapshot.topic_publishers_.at("topic_a"));
+  EXPECT_EQ(
+    (std::vector<std::string>{"/ns/listener", "/other"}),
+    snapshot.topic_subscribers_.at("topic_a"));
+  EXPECT_EQ(0U, snapshot.topic_subscribers_.count("topic_b"));
+}
+
+TEST_F(GraphCacheTest, endpoints_are_counted_per_topic)
+{
+  port_sample_->m_publisherList.push_back(
+    make_port<iox::roudi::PublisherPortData>("TypeA", "topic_a", "/ns/talker"));
+  port_sample_->m_publisherList.push_back(
+    make_port<iox::roudi::PublisherPortData>("TypeA", "topic_a", "/ns/other_talker"));
+  port_sample_->m_subscriberList.push_back(
+    make_port<iox::roudi::SubscriberPortData>("TypeA", "topic_a", "/ns/listener"));
+  port_sample_->m_subscriberList.push_back(
+    make_port<iox::roudi::SubscriberPortData>("TypeB", "topic_b", "/ns/listener"));
+
+  auto snapshot = rmw_iceoryx_cpp::build_graph_snapshot(*port_sample_);
+
+  EXPECT_EQ(2U, snapshot.count_endpoints("topic_a").publishers_);
+  EXPECT_EQ(1U, snapshot.count_endpoints("topic_a").subscribers_);
+  EXPECT_EQ(0U, snapshot.count_endpoints("topic_b").publishers_);
+  EXPECT_EQ(1U, snapshot.count_endpoints("topic_b").subscribers_);
+  EXPECT_EQ(0U, snapshot.count_endpoints("unknown").publishers_);
+  EXPECT_EQ(0U, snapshot.count_endpoints("unknown").subscribers_);
+}
+
+TEST_F(GraphCacheTest, unchanged_endpoints_yield_an_empty_change)
+{
+  port_sample_->m_publisherList.push_back(
+    make_port<iox::roudi::PublisherPortData>("TypeA", "topic_a", "/ns/talker"));
+  port_sample_->m_subscriberList.push_back(
+    make_port<iox::roudi::SubscriberPortData>("TypeA", "topic_a", "/ns/listener"));
+
+  auto endpoints = rmw_iceoryx_cpp::collect_graph_endpoints(*port_sample_);
+  ASSERT_EQ(2U, endpoints.size());
+
+  auto change = rmw_iceoryx_cpp::diff_graph_endpoints(endpoints, endpoints);
+  EXPECT_TRUE(change.empty());
+  EXPECT_EQ(0U, change.generation_);
+}
+
+TEST_F(GraphCacheTest, added_and_removed_endpoints_are_reported)
+{
+  port_sample_->m_publisherList.push_back(
+    make_port<iox::roudi::PublisherPortData>("TypeA", "topic_a", "/ns/talker"));
+  port_sample_->m_subscriberList.push_back(
+    make_port<iox::roudi::SubscriberPortData>("TypeA", "topic_a", "/ns/listener"));
+  auto previous = rmw_iceoryx_cpp::collect_graph_endpoints(*port_sample_);
+
+  port_sample_->m_subscriberList.clear();
+  port_sample_->m_publisherList.push_back(
+    make_port<iox::roudi::PublisherPortData>("TypeA", "topic_a", "/ns/talker"));
+  auto current = rmw_iceoryx_cpp::collect_graph_endpoints(*port_sample_);
+
+  auto change = rmw_iceoryx_cpp::diff_graph_endpoints(previous, current);
+
+  // the second publisher of the same node on the same topic is a change as well
+  ASSERT_EQ(1U, change.added_.size());
+  EXPECT_EQ(rmw_iceoryx_cpp::GraphEndpoint::Kind::PUBLISHER, change.added_[0].kind_);
+  EXPECT_EQ("topic_a", change.added_[0].topic_name_);
+  EXPECT_EQ("TypeA", change.added_[0].type_name_);
+  EXPECT_EQ("/ns/talker", change.added_[0].node_name_);
+
+  ASSERT_EQ(1U, change.removed_.size());
+  EXPECT_EQ(rmw_iceoryx_cpp::GraphEndpoint::Kind::SUBSCRIBER, change.removed_[0].kind_);
+  EXPECT_EQ("/ns/listener", change.removed_[0].node_name_);
+}
+
+TEST_F(GraphCacheTest, publishers_of_the_endpoints_are_counted_per_topic)
+{
+  port_sample_->m_publisherList.push_back(
+    make_port<iox::roudi::PublisherPortData>("TypeA", "topic_a", "/ns/talker"));
+  port_sample_->m_publisherList.push_back(
+    make_port<iox::roudi::PublisherPortData>("TypeA", "topic_a", "/ns/talker"));
+  port_sample_->m_subscriberList.push_back(
+    make_port<iox::roudi::SubscriberPortData>("TypeB", "topic_b", "/ns/listener"));
+
+  rmw_iceoryx_cpp::GraphChange change;
+  change.topic_publisher_counts_ = rmw_iceoryx_cpp::count_graph_publishers(
+    rmw_iceoryx_cpp::collect_graph_endpoints(*port_sample_));
+
+  EXPECT_EQ(2U, change.count_publishers("topic_a"));
+  EXPECT_EQ(0U, change.count_publishers("topic_b"));
+  EXPECT_EQ(0U, change.count_publishers("unknown"));
+}
+
+TEST_F(GraphCacheTest, endpoint_records_carry_node_type_and_port_id)
+{
+  auto publisher = make_port<iox::roudi::PublisherPortData>("TypeA", "topic_a", "/ns/talker");
+  publisher.m_publisherPortID = 42U;
+  port_sample_->m_publisherList.push_back(publisher);
+  port_sample_->m_subscriberList.push_back(
+    make_port<iox::roudi::SubscriberPortData>("TypeA", "topic_a", "/listener"));
+
+  auto snapshot = rmw_iceoryx_cpp::build_graph_snapshot(*port_sample_);
+
+  ASSERT_EQ(1U, snapshot.topic_publisher_records_.at("topic_a").size());
+  const auto & publisher_record = snapshot.topic_publisher_records_.at("topic_a")[0];
+  EXPECT_EQ("talker", publisher_record.node_name_);
+  EXPECT_EQ("/ns", publisher_record.node_namespace_);
+  ASSERT_NE(nullptr, publisher_record.type_name_);
+  EXPECT_EQ("TypeA", *publisher_record.type_name_);
+  EXPECT_EQ(42U, publisher_record.port_id_);
+
+  ASSERT_EQ(1U, snapshot.topic_subscriber_records_.at("topic_a").size());
+  const auto & subscriber_record = snapshot.topic_subscriber_records_.at("topic_a")[0];
+  EXPECT_EQ("listener", subscriber_record.node_name_);
+  EXPECT_EQ("", subscriber_record.node_namespace_);
+  EXPECT_EQ(0U, subscriber_record.port_id_);
+  EXPECT_EQ(RMW_QOS_POLICY_RELIABILITY_UNKNOWN, subscriber_record.qos_.reliability);
+}
+
+TEST(NodeNamesCacheTest, node_names_are_split_sorted_and_unique)
+{
+  // the introspection sample is too large for the stack
+  std::unique_ptr<iox::roudi::ProcessIntrospectionFieldTopic> process_sample{
+    new iox::roudi::ProcessIntrospectionFieldTopic()};
+
+  iox::roudi::ProcessIntrospectionData talker_process;
+  talker_process.m_nodes.push_back(iox::NodeName_t(iox::cxx::TruncateToCapacity, "/ns/talker"));
+  talker_process.m_nodes.push_back(iox::NodeName_t(iox::cxx::TruncateToCapacity, "/a_node"));
+  process_sample->m_processList.push_back(talker_process);
+  iox::roudi::ProcessIntrospectionData listener_process;
+  listener_process.m_nodes.push_back(iox::NodeName_t(iox::cxx::TruncateToCapacity, "/ns/talker"));
+  process_sample->m_processList.push_back(listener_process);
+
+  auto snapshot = rmw_iceoryx_cpp::build_node_names_snapshot(*process_sample);
+
+  EXPECT_EQ(0U, snapshot.generation_);
+  EXPECT_EQ((std::vector<std::string>{"a_node", "talker"}), snapshot.node_names_);
+  EXPECT_EQ((std::vector<std::string>{"", "/ns"}), snapshot.node_namespaces_);
+}
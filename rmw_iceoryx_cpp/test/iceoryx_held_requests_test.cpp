@@ -0,0 +1,259 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "../src/types/iceoryx_server.hpp"
+
+namespace
+{
+constexpr uint64_t CLIENT_ID{1U};
+// four held requests give a table of eight slots
+constexpr uint64_t MAX_HELD{4U};
+constexpr uint64_t CAPACITY{8U};
+
+/// @brief Mirrors the hash of IceoryxHeldRequests, so that the tests can build probe chains
+uint64_t home(uint64_t client_id, int64_t sequence_id)
+{
+  uint64_t hash = client_id * 0x9E3779B97F4A7C15ULL ^ static_cast<uint64_t>(sequence_id);
+  hash ^= hash >> 32U;
+  return hash & (CAPACITY - 1U);
+}
+
+/// @return the first 'count' sequence ids of CLIENT_ID whose preferred slot is 'slot'
+std::vector<int64_t> sequence_ids_with_home(uint64_t slot, size_t count)
+{
+  std::vector<int64_t> sequence_ids;
+  for (int64_t sequence_id = 0; sequence_ids.size() < count; ++sequence_id) {
+    if (home(CLIENT_ID, sequence_id) == slot) {
+      sequence_ids.push_back(sequence_id);
+    }
+  }
+  return sequence_ids;
+}
+}  // namespace
+
+class HeldRequestsTest : public ::testing::Test
+{
+protected:
+  const void * payload(size_t index) const
+  {
+    return &payloads_[index];
+  }
+
+  IceoryxHeldRequests held_requests_{MAX_HELD};
+
+private:
+  int payloads_[MAX_HELD * 2U]{};
+};
+
+TEST_F(HeldRequestsTest, inserted_request_is_found_until_removed)
+{
+  EXPECT_TRUE(held_requests_.empty());
+  ASSERT_TRUE(held_requests_.insert(CLIENT_ID, 7, payload(0), 0));
+  EXPECT_FALSE(held_requests_.empty());
+
+  EXPECT_EQ(payload(0), held_requests_.find(CLIENT_ID, 7));
+  EXPECT_EQ(payload(0), held_requests_.remove(CLIENT_ID, 7));
+  EXPECT_EQ(nullptr, held_requests_.find(CLIENT_ID, 7));
+  EXPECT_EQ(nullptr, held_requests_.remove(CLIENT_ID, 7));
+  EXPECT_TRUE(held_requests_.empty());
+}
+
+TEST_F(HeldRequestsTest, unknown_request_is_not_found)
+{
+  ASSERT_TRUE(held_requests_.insert(CLIENT_ID, 7, payload(0), 0));
+
+  EXPECT_EQ(nullptr, held_requests_.find(CLIENT_ID, 8));
+  EXPECT_EQ(nullptr, held_requests_.find(CLIENT_ID + 1U, 7));
+  EXPECT_EQ(nullptr, held_requests_.remove(CLIENT_ID + 1U, 7));
+  EXPECT_EQ(payload(0), held_requests_.find(CLIENT_ID, 7));
+}
+
+TEST_F(HeldRequestsTest, request_is_held_only_once)
+{
+  ASSERT_TRUE(held_requests_.insert(CLIENT_ID, 7, payload(0), 0));
+  EXPECT_FALSE(held_requests_.insert(CLIENT_ID, 7, payload(1), 0));
+
+  EXPECT_EQ(payload(0), held_requests_.remove(CLIENT_ID, 7));
+  EXPECT_TRUE(held_requests_.empty());
+}
+
+TEST_F(HeldRequestsTest, full_table_rejects_further_requests)
+{
+  for (int64_t sequence_id = 0; sequence_id < static_cast<int64_t>(MAX_HELD); ++sequence_id) {
+    ASSERT_TRUE(held_requests_.insert(CLIENT_ID, sequence_id, payload(sequence_id), 0));
+  }
+  EXPECT_TRUE(held_requests_.full());
+  EXPECT_FALSE(held_requests_.insert(CLIENT_ID, 100, payload(MAX_HELD), 0));
+
+  // a removed request makes room again
+  EXPECT_EQ(payload(1), held_requests_.remove(CLIENT_ID, 1));
+  EXPECT_FALSE(held_requests_.full());
+  EXPECT_TRUE(held_requests_.insert(CLIENT_ID, 100, payload(MAX_HELD), 0));
+}
+
+TEST_F(HeldRequestsTest, requests_are_removed_out_of_order)
+{
+  for (int64_t sequence_id = 0; sequence_id < static_cast<int64_t>(MAX_HELD); ++sequence_id) {
+    ASSERT_TRUE(held_requests_.insert(CLIENT_ID, sequence_id, payload(sequence_id), 0));
+  }
+
+  for (int64_t sequence_id : {2, 0, 3, 1}) {
+    EXPECT_EQ(payload(sequence_id), held_requests_.remove(CLIENT_ID, sequence_id));
+  }
+  EXPECT_TRUE(held_requests_.empty());
+}
+
+TEST_F(HeldRequestsTest, erase_in_the_middle_of_a_probe_chain_keeps_the_chain)
+{
+  // three requests with the same preferred slot form a chain of three consecutive slots
+  auto colliding = sequence_ids_with_home(2U, 3U);
+  for (size_t i = 0U; i < colliding.size(); ++i) {
+    ASSERT_TRUE(held_requests_.insert(CLIENT_ID, colliding[i], payload(i), 0));
+  }
+
+  EXPECT_EQ(payload(1), held_requests_.remove(CLIENT_ID, colliding[1]));
+  EXPECT_EQ(payload(0), held_requests_.find(CLIENT_ID, colliding[0]));
+  EXPECT_EQ(payload(2), held_requests_.find(CLIENT_ID, colliding[2]));
+  EXPECT_EQ(nullptr, held_requests_.find(CLIENT_ID, colliding[1]));
+
+  EXPECT_EQ(payload(0), held_requests_.remove(CLIENT_ID, colliding[0]));
+  EXPECT_EQ(payload(2), held_requests_.find(CLIENT_ID, colliding[2]));
+}
+
+TEST_F(HeldRequestsTest, erase_keeps_entries_which_are_in_their_preferred_slot)
+{
+  // the first two requests occupy slots 2 and 3, the third one prefers slot 3 and moves on to 4
+  auto colliding = sequence_ids_with_home(2U, 2U);
+  auto displaced = sequence_ids_with_home(3U, 1U);
+  ASSERT_TRUE(held_requests_.insert(CLIENT_ID, colliding[0], payload(0), 0));
+  ASSERT_TRUE(held_requests_.insert(CLIENT_ID, colliding[1], payload(1), 0));
+  ASSERT_TRUE(held_requests_.insert(CLIENT_ID, displaced[0], payload(2), 0));
+
+  // removing the head shifts both followers back by one slot
+  EXPECT_EQ(payload(0), held_requests_.remove(CLIENT_ID, colliding[0]));
+  EXPECT_EQ(payload(1), held_requests_.find(CLIENT_ID, colliding[1]));
+  EXPECT_EQ(payload(2), held_requests_.find(CLIENT_ID, displaced[0]));
+
+  EXPECT_EQ(payload(2), held_requests_.remove(CLIENT_ID, displaced[0]));
+  EXPECT_EQ(payload(1), held_requests_.remove(CLIENT_ID, colliding[1]));
+  EXPECT_TRUE(held_requests_.empty());
+}
+
+TEST_F(HeldRequestsTest, probe_chain_wraps_around_the_end_of_the_table)
+{
+  // the chain starts in the last slot and continues in the first ones
+  auto colliding = sequence_ids_with_home(CAPACITY - 1U, 3U);
+  auto first_slot = sequence_ids_with_home(0U, 1U);
+  for (size_t i = 0U; i < colliding.size(); ++i) {
+    ASSERT_TRUE(held_requests_.insert(CLIENT_ID, colliding[i], payload(i), 0));
+  }
+  ASSERT_TRUE(held_requests_.insert(CLIENT_ID, first_slot[0], payload(3), 0));
+
+  for (size_t i = 0U; i < colliding.size(); ++i) {
+    EXPECT_EQ(payload(i), held_requests_.find(CLIENT_ID, colliding[i]));
+  }
+  EXPECT_EQ(payload(3), held_requests_.find(CLIENT_ID, first_slot[0]));
+
+  // erasing in the last slot shifts the entries across the end of the table
+  EXPECT_EQ(payload(0), held_requests_.remove(CLIENT_ID, colliding[0]));
+  EXPECT_EQ(payload(1), held_requests_.find(CLIENT_ID, colliding[1]));
+  EXPECT_EQ(payload(2), held_requests_.find(CLIENT_ID, colliding[2]));
+  EXPECT_EQ(payload(3), held_requests_.find(CLIENT_ID, first_slot[0]));
+
+  EXPECT_EQ(payload(2), held_requests_.remove(CLIENT_ID, colliding[2]));
+  EXPECT_EQ(payload(1), held_requests_.remove(CLIENT_ID, colliding[1]));
+  EXPECT_EQ(payload(3), held_requests_.remove(CLIENT_ID, first_slot[0]));
+  EXPECT_TRUE(held_requests_.empty());
+}
+
+TEST_F(HeldRequestsTest, requests_taken_before_the_deadline_are_released)
+{
+  for (int64_t sequence_id = 0; sequence_id < static_cast<int64_t>(MAX_HELD); ++sequence_id) {
+    ASSERT_TRUE(
+      held_requests_.insert(CLIENT_ID, sequence_id, payload(sequence_id), 10 * sequence_id));
+  }
+
+  std::vector<const void *> released;
+  auto release = [&](const void * request_payload) {released.push_back(request_payload);};
+  EXPECT_EQ(2U, held_requests_.remove_taken_before(10, release));
+  ASSERT_EQ(2U, released.size());
+  EXPECT_NE(released.end(), std::find(released.begin(), released.end(), payload(0)));
+  EXPECT_NE(released.end(), std::find(released.begin(), released.end(), payload(1)));
+
+  EXPECT_EQ(nullptr, held_requests_.find(CLIENT_ID, 0));
+  EXPECT_EQ(nullptr, held_requests_.find(CLIENT_ID, 1));
+  EXPECT_EQ(payload(2), held_requests_.find(CLIENT_ID, 2));
+  EXPECT_EQ(payload(3), held_requests_.find(CLIENT_ID, 3));
+
+  // nothing else is overdue
+  EXPECT_EQ(0U, held_requests_.remove_taken_before(19, release));
+  EXPECT_EQ(2U, released.size());
+}
+
+TEST_F(HeldRequestsTest, oldest_requests_are_released_together)
+{
+  ASSERT_TRUE(held_requests_.insert(CLIENT_ID, 0, payload(0), 20));
+  ASSERT_TRUE(held_requests_.insert(CLIENT_ID, 1, payload(1), 10));
+  ASSERT_TRUE(held_requests_.insert(CLIENT_ID, 2, payload(2), 10));
+  ASSERT_TRUE(held_requests_.insert(CLIENT_ID, 3, payload(3), 30));
+
+  uint64_t released{0U};
+  auto release = [&](const void *) {++released;};
+  // both requests taken at the same time are removed and counted
+  EXPECT_EQ(2U, held_requests_.remove_oldest(release));
+  EXPECT_EQ(2U, released);
+  EXPECT_EQ(nullptr, held_requests_.find(CLIENT_ID, 1));
+  EXPECT_EQ(nullptr, held_requests_.find(CLIENT_ID, 2));
+
+  EXPECT_EQ(1U, held_requests_.remove_oldest(release));
+  EXPECT_EQ(nullptr, held_requests_.find(CLIENT_ID, 0));
+  EXPECT_EQ(payload(3), held_requests_.find(CLIENT_ID, 3));
+}
+
+TEST_F(HeldRequestsTest, oldest_request_is_found_after_the_previous_oldest_was_answered)
+{
+  ASSERT_TRUE(held_requests_.insert(CLIENT_ID, 0, payload(0), 10));
+  ASSERT_TRUE(held_requests_.insert(CLIENT_ID, 1, payload(1), 20));
+  ASSERT_TRUE(held_requests_.insert(CLIENT_ID, 2, payload(2), 30));
+  EXPECT_EQ(payload(0), held_requests_.remove(CLIENT_ID, 0));
+
+  std::vector<const void *> released;
+  auto release = [&](const void * request_payload) {released.push_back(request_payload);};
+  EXPECT_EQ(1U, held_requests_.remove_oldest(release));
+  ASSERT_EQ(1U, released.size());
+  EXPECT_EQ(payload(1), released[0]);
+}
+
+TEST_F(HeldRequestsTest, loaned_requests_are_never_reclaimed)
+{
+  ASSERT_TRUE(held_requests_.insert(CLIENT_ID, 0, payload(0), 10, true));
+  ASSERT_TRUE(held_requests_.insert(CLIENT_ID, 1, payload(1), 20));
+
+  uint64_t released{0U};
+  auto release = [&](const void *) {++released;};
+  EXPECT_EQ(1U, held_requests_.remove_taken_before(100, release));
+  EXPECT_EQ(0U, held_requests_.remove_oldest(release));
+  EXPECT_EQ(1U, released);
+
+  // a loaned request is only removed with its response
+  EXPECT_EQ(payload(0), held_requests_.remove(CLIENT_ID, 0));
+  EXPECT_TRUE(held_requests_.empty());
+  EXPECT_EQ(0U, held_requests_.remove_oldest(release));
+}
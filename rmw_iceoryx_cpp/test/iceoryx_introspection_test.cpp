@@ -0,0 +1,84 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <utility>
+
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/roudi/introspection_types.hpp"
+
+#include "rmw_iceoryx_cpp/iceoryx_graph_cache.hpp"
+
+#include "./rmw_roudi_environment.hpp"
+
+namespace
+{
+/// @brief Subscribes like the graph cache does, without waiting for a sample
+class IntrospectionSubscriber
+{
+public:
+  explicit IntrospectionSubscriber(const iox::capro::ServiceDescription & service)
+  : subscriber_(service, iox::popo::SubscriberOptions{1U, 1U, "", true})
+  {
+    subscriber_.subscribe();
+  }
+
+  // iceoryx needs a runtime before the subscriber is created, the environment registers it
+  RmwRouDiEnvironment & environment_{RmwRouDiEnvironment::instance()};
+  iox::popo::UntypedSubscriber subscriber_;
+};
+
+/// @return the time 'wait_for_introspection_sample' took and whether it got a sample
+std::pair<std::chrono::milliseconds, bool>
+timed_wait(iox::popo::UntypedSubscriber & subscriber, std::chrono::milliseconds timeout)
+{
+  auto start = std::chrono::steady_clock::now();
+  bool has_sample = rmw_iceoryx_cpp::wait_for_introspection_sample(subscriber, timeout);
+  return {
+    std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start),
+    has_sample};
+}
+}  // namespace
+
+TEST(IntrospectionTest, first_sample_of_roudi_ends_the_wait_early)
+{
+  IntrospectionSubscriber port_introspection(iox::roudi::IntrospectionPortService);
+
+  auto result = timed_wait(
+    port_introspection.subscriber_, rmw_iceoryx_cpp::INTROSPECTION_SAMPLE_TIMEOUT);
+  EXPECT_TRUE(result.second);
+  EXPECT_LT(result.first, rmw_iceoryx_cpp::INTROSPECTION_SAMPLE_TIMEOUT);
+}
+
+TEST(IntrospectionTest, missing_introspection_returns_after_the_timeout)
+{
+  // nobody offers this service, like an introspection which RouDi does not publish
+  IntrospectionSubscriber missing_introspection(
+    iox::capro::ServiceDescription{"Introspection", "RouDi_ID", "NotOffered"});
+
+  const std::chrono::milliseconds timeout{100};
+  auto result = timed_wait(missing_introspection.subscriber_, timeout);
+  EXPECT_FALSE(result.second);
+  EXPECT_GE(result.first, timeout);
+  EXPECT_LT(result.first, rmw_iceoryx_cpp::INTROSPECTION_SAMPLE_TIMEOUT);
+
+  // the default timeout bounds the startup of the graph caches
+  result = timed_wait(
+    missing_introspection.subscriber_, rmw_iceoryx_cpp::INTROSPECTION_SAMPLE_TIMEOUT);
+  EXPECT_FALSE(result.second);
+  EXPECT_LT(result.first, 2 * rmw_iceoryx_cpp::INTROSPECTION_SAMPLE_TIMEOUT);
+}
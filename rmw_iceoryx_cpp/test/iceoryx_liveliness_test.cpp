@@ -0,0 +1,157 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../src/types/iceoryx_liveliness.hpp"
+
+namespace
+{
+/// @brief Updates the liveliness for the graph 'generation' with 'publishers' on the topic
+void update(IceoryxSubscriptionLiveliness & liveliness, uint64_t generation, size_t publishers)
+{
+  rmw_iceoryx_cpp::GraphChange change;
+  change.generation_ = generation;
+  if (publishers > 0U) {
+    change.topic_publisher_counts_["/chatter"] = publishers;
+  }
+  liveliness.update(change, "/chatter");
+}
+
+rmw_liveliness_changed_status_t take(IceoryxSubscriptionLiveliness & liveliness)
+{
+  rmw_liveliness_changed_status_t status{};
+  liveliness.take(status);
+  return status;
+}
+}  // namespace
+
+TEST(SubscriptionLivelinessTest, publishers_are_counted_on_first_change)
+{
+  IceoryxSubscriptionLiveliness liveliness;
+  EXPECT_FALSE(liveliness.has_changed());
+
+  // the notifier numbers its changes from 1
+  update(liveliness, 1U, 2U);
+  ASSERT_TRUE(liveliness.has_changed());
+
+  auto status = take(liveliness);
+  EXPECT_EQ(2, status.alive_count);
+  EXPECT_EQ(2, status.alive_count_change);
+  EXPECT_EQ(0, status.not_alive_count);
+  EXPECT_EQ(0, status.not_alive_count_change);
+  EXPECT_FALSE(liveliness.has_changed());
+}
+
+TEST(SubscriptionLivelinessTest, publishers_on_other_topics_are_not_counted)
+{
+  IceoryxSubscriptionLiveliness liveliness;
+  rmw_iceoryx_cpp::GraphChange change;
+  change.generation_ = 1U;
+  change.topic_publisher_counts_["/other"] = 3U;
+  liveliness.update(change, "/chatter");
+  EXPECT_FALSE(liveliness.has_changed());
+}
+
+TEST(SubscriptionLivelinessTest, publishers_are_recounted_only_for_a_new_generation)
+{
+  IceoryxSubscriptionLiveliness liveliness;
+  update(liveliness, 1U, 1U);
+  take(liveliness);
+
+  // the same generation is not counted again
+  update(liveliness, 1U, 5U);
+  EXPECT_FALSE(liveliness.has_changed());
+
+  update(liveliness, 2U, 3U);
+  ASSERT_TRUE(liveliness.has_changed());
+  auto status = take(liveliness);
+  EXPECT_EQ(3, status.alive_count);
+  EXPECT_EQ(2, status.alive_count_change);
+}
+
+TEST(SubscriptionLivelinessTest, lost_publishers_decrease_the_alive_count)
+{
+  IceoryxSubscriptionLiveliness liveliness;
+  update(liveliness, 1U, 2U);
+  take(liveliness);
+
+  update(liveliness, 2U, 0U);
+  ASSERT_TRUE(liveliness.has_changed());
+  auto status = take(liveliness);
+  EXPECT_EQ(0, status.alive_count);
+  EXPECT_EQ(-2, status.alive_count_change);
+  EXPECT_EQ(0, status.not_alive_count);
+  EXPECT_EQ(0, status.not_alive_count_change);
+}
+
+TEST(SubscriptionLivelinessTest, changes_accumulate_until_taken)
+{
+  IceoryxSubscriptionLiveliness liveliness;
+  update(liveliness, 1U, 1U);
+  update(liveliness, 2U, 4U);
+  update(liveliness, 3U, 2U);
+
+  auto status = take(liveliness);
+  EXPECT_EQ(2, status.alive_count);
+  EXPECT_EQ(2, status.alive_count_change);
+}
+
+TEST(PublisherLivelinessTest, automatic_liveliness_is_never_lost)
+{
+  auto qos = rmw_qos_profile_default;
+  qos.liveliness = RMW_QOS_POLICY_LIVELINESS_AUTOMATIC;
+  qos.liveliness_lease_duration = rmw_time_t{0U, 1000U};
+  IceoryxPublisherLiveliness liveliness(qos);
+
+  EXPECT_FALSE(liveliness.is_enabled());
+  EXPECT_EQ(
+    IceoryxDeadline::NO_UPDATE_NEEDED,
+    liveliness.update(RCUTILS_S_TO_NS(1000), 0));
+  EXPECT_FALSE(liveliness.has_changed());
+}
+
+TEST(PublisherLivelinessTest, liveliness_is_lost_once_per_expired_lease)
+{
+  auto qos = rmw_qos_profile_default;
+  qos.liveliness = RMW_QOS_POLICY_LIVELINESS_MANUAL_BY_TOPIC;
+  qos.liveliness_lease_duration = rmw_time_t{0U, 10000000U};
+  IceoryxPublisherLiveliness liveliness(qos);
+  ASSERT_TRUE(liveliness.is_enabled());
+
+  rcutils_time_point_value_t now{0};
+  rcutils_system_time_now(&now);
+  liveliness.assert_liveliness(now);
+  EXPECT_EQ(RCUTILS_MS_TO_NS(10), liveliness.update(now, 0));
+  EXPECT_FALSE(liveliness.has_changed());
+
+  // the lease expires, further updates without assertion do not count it again
+  liveliness.update(now + RCUTILS_MS_TO_NS(20), 0);
+  liveliness.update(now + RCUTILS_MS_TO_NS(40), 0);
+  ASSERT_TRUE(liveliness.has_changed());
+  rmw_liveliness_lost_status_t status{};
+  liveliness.take(status);
+  EXPECT_EQ(1, status.total_count);
+  EXPECT_EQ(1, status.total_count_change);
+
+  // a publish call renews the lease, the next expiry is counted again
+  liveliness.update(now + RCUTILS_MS_TO_NS(45), now + RCUTILS_MS_TO_NS(41));
+  liveliness.update(now + RCUTILS_MS_TO_NS(60), now + RCUTILS_MS_TO_NS(41));
+  liveliness.take(status);
+  EXPECT_EQ(2, status.total_count);
+  EXPECT_EQ(1, status.total_count_change);
+}
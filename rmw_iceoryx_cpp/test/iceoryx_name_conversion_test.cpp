@@ -20,6 +20,8 @@
 #include <tuple>
 #include <vector>
 
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
 TEST(NameConverisonTests, get_name_n_type_from_service_description)
 {
   auto topic_and_type = rmw_iceoryx_cpp::get_name_n_type_from_service_description(
@@ -108,3 +110,41 @@ TEST(NameConverisonTests, flip_flop_reverse)
     EXPECT_EQ(tuple, flip_flop_tuple);
   }
 }
+
+TEST(NameConverisonTests, interned_name_n_type_is_converted_once)
+{
+  iox::capro::IdString_t service(iox::cxx::TruncateToCapacity, "SERVICE");
+  iox::capro::IdString_t instance(iox::cxx::TruncateToCapacity, "INSTANCE");
+  iox::capro::IdString_t event(iox::cxx::TruncateToCapacity, "EVENT");
+
+  auto interned = rmw_iceoryx_cpp::get_interned_name_n_type(service, instance, event);
+  EXPECT_EQ("/INSTANCE/SERVICE/EVENT", interned->name_);
+  EXPECT_EQ("service_ara_msgs/msg/EVENT", interned->type_);
+
+  // the same triplet yields the same handle, a different one a different handle
+  EXPECT_EQ(interned, rmw_iceoryx_cpp::get_interned_name_n_type(service, instance, event));
+  iox::capro::IdString_t data(iox::cxx::TruncateToCapacity, "data");
+  auto other = rmw_iceoryx_cpp::get_interned_name_n_type(service, instance, data);
+  EXPECT_NE(interned, other);
+  EXPECT_EQ("INSTANCE", other->name_);
+  EXPECT_EQ("SERVICE", other->type_);
+}
+
+TEST(NameConverisonTests, interned_names_in_use_survive_the_sweep)
+{
+  iox::capro::IdString_t service(iox::cxx::TruncateToCapacity, "SWEPT");
+  iox::capro::IdString_t instance(iox::cxx::TruncateToCapacity, "INSTANCE");
+  iox::capro::IdString_t event(iox::cxx::TruncateToCapacity, "EVENT");
+  auto held = rmw_iceoryx_cpp::get_interned_name_n_type(service, instance, event);
+
+  // more distinct names than RouDi holds ports, none of them held, exceed the bound
+  constexpr size_t NAMES = 2U *
+    (iox::MAX_PUBLISHERS + iox::MAX_SUBSCRIBERS + iox::MAX_SERVERS + iox::MAX_CLIENTS);
+  for (size_t i = 0U; i < NAMES; ++i) {
+    iox::capro::IdString_t churned(iox::cxx::TruncateToCapacity, std::to_string(i).c_str());
+    rmw_iceoryx_cpp::get_interned_name_n_type(service, churned, event);
+  }
+
+  EXPECT_EQ(held, rmw_iceoryx_cpp::get_interned_name_n_type(service, instance, event));
+  EXPECT_EQ("/INSTANCE/SWEPT/EVENT", held->name_);
+}
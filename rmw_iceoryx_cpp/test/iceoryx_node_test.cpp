@@ -0,0 +1,87 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include "rmw/error_handling.h"
+#include "rmw/rmw.h"
+
+#include "rosidl_typesupport_cpp/message_type_support.hpp"
+
+#include "test_msgs/msg/basic_types.hpp"
+
+#include "../src/types/iceoryx_node.hpp"
+#include "./rmw_roudi_environment.hpp"
+
+namespace
+{
+// RouDi publishes the port introspection periodically, a graph change may take a while
+constexpr rmw_time_t GRAPH_CHANGE_TIMEOUT{5U, 0U};
+
+/// @brief Wait in a wait set of its own until the graph guard condition of the node triggers
+/// @return true if it triggered within GRAPH_CHANGE_TIMEOUT
+bool wait_for_graph_change(const rmw_node_t * node)
+{
+  auto wait_set = rmw_create_wait_set(RmwRouDiEnvironment::instance().context(), 1U);
+  if (!wait_set) {
+    return false;
+  }
+  void * handles[1] = {rmw_node_get_graph_guard_condition(node)->data};
+  rmw_subscriptions_t subscriptions{0U, nullptr};
+  rmw_guard_conditions_t guard_conditions{1U, handles};
+  rmw_services_t services{0U, nullptr};
+  rmw_clients_t clients{0U, nullptr};
+  rmw_events_t events{0U, nullptr};
+  auto ret = rmw_wait(
+    &subscriptions, &guard_conditions, &services, &clients, &events, wait_set,
+    &GRAPH_CHANGE_TIMEOUT);
+  rmw_destroy_wait_set(wait_set);
+  return RMW_RET_OK == ret && handles[0];
+}
+}  // namespace
+
+TEST(NodeTest, nodes_of_a_context_share_one_graph_change_notifier)
+{
+  auto & environment = RmwRouDiEnvironment::instance();
+  auto node = rmw_create_node(environment.context(), "node_test", "/");
+  ASSERT_NE(nullptr, node) << rmw_get_error_string().str;
+
+  auto node_info = static_cast<IceoryxNodeInfo *>(node->data);
+  auto environment_node_info = static_cast<IceoryxNodeInfo *>(environment.node()->data);
+  ASSERT_NE(nullptr, node_info->graph_change_notifier_);
+  EXPECT_EQ(environment_node_info->graph_change_notifier_, node_info->graph_change_notifier_);
+
+  // every node waits on its own, a single graph change wakes up both
+  auto node_triggered = std::async(std::launch::async, wait_for_graph_change, node);
+  auto environment_node_triggered =
+    std::async(std::launch::async, wait_for_graph_change, environment.node());
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  auto options = rmw_get_default_publisher_options();
+  auto publisher = rmw_create_publisher(
+    node, rosidl_typesupport_cpp::get_message_type_support_handle<test_msgs::msg::BasicTypes>(),
+    "/node_test_topic", &rmw_qos_profile_default, &options);
+  ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+  environment.discover();
+
+  EXPECT_TRUE(node_triggered.get());
+  EXPECT_TRUE(environment_node_triggered.get());
+
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_publisher(node, publisher));
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_node(node));
+}
@@ -0,0 +1,368 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+
+#include "rmw/error_handling.h"
+#include "rmw/event.h"
+#include "rmw/rmw.h"
+
+#include "rmw_iceoryx_cpp/iceoryx_name_conversion.hpp"
+#include "rmw_iceoryx_cpp/iceoryx_statistics.hpp"
+
+#include "rosidl_typesupport_cpp/message_type_support.hpp"
+
+#include "test_msgs/msg/basic_types.hpp"
+
+#include "../src/types/iceoryx_user_header.hpp"
+#include "./rmw_roudi_environment.hpp"
+
+/// @brief Publishers and subscriptions of BasicTypes on a topic of their own, destroyed after
+///        every test
+class PublishTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    static size_t test{0U};
+    topic_name_ = "/publish_test_" + std::to_string(test++);
+    wait_set_ = rmw_create_wait_set(RmwRouDiEnvironment::instance().context(), 1U);
+    ASSERT_NE(nullptr, wait_set_) << rmw_get_error_string().str;
+  }
+
+  void TearDown() override
+  {
+    auto node = RmwRouDiEnvironment::instance().node();
+    for (auto subscription : subscriptions_) {
+      EXPECT_EQ(RMW_RET_OK, rmw_destroy_subscription(node, subscription));
+    }
+    for (auto publisher : publishers_) {
+      EXPECT_EQ(RMW_RET_OK, rmw_destroy_publisher(node, publisher));
+    }
+    if (wait_set_) {
+      EXPECT_EQ(RMW_RET_OK, rmw_destroy_wait_set(wait_set_));
+    }
+  }
+
+  rmw_publisher_t * create_publisher(const rmw_qos_profile_t & qos)
+  {
+    auto options = rmw_get_default_publisher_options();
+    auto publisher = rmw_create_publisher(
+      RmwRouDiEnvironment::instance().node(), type_support(), topic_name_.c_str(), &qos,
+      &options);
+    if (publisher) {
+      publishers_.push_back(publisher);
+    }
+    return publisher;
+  }
+
+  rmw_subscription_t * create_subscription(const rmw_qos_profile_t & qos)
+  {
+    auto options = rmw_get_default_subscription_options();
+    auto subscription = rmw_create_subscription(
+      RmwRouDiEnvironment::instance().node(), type_support(), topic_name_.c_str(), &qos,
+      &options);
+    if (subscription) {
+      subscriptions_.push_back(subscription);
+    }
+    return subscription;
+  }
+
+  static uint64_t skipped_publish_count(const rmw_publisher_t * publisher)
+  {
+    uint64_t count = 0U;
+    EXPECT_EQ(RMW_RET_OK, rmw_iceoryx_cpp::get_skipped_publish_count(publisher, &count));
+    return count;
+  }
+
+  static const rosidl_message_type_support_t * type_support()
+  {
+    return rosidl_typesupport_cpp::get_message_type_support_handle<test_msgs::msg::BasicTypes>();
+  }
+
+  std::string topic_name_;
+  rmw_wait_set_t * wait_set_{nullptr};
+
+private:
+  std::vector<rmw_publisher_t *> publishers_;
+  std::vector<rmw_subscription_t *> subscriptions_;
+};
+
+TEST_F(PublishTest, publish_without_subscription_is_skipped)
+{
+  auto publisher = create_publisher(rmw_qos_profile_default);
+  ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+
+  test_msgs::msg::BasicTypes message;
+  message.int32_value = 1;
+  EXPECT_EQ(RMW_RET_OK, rmw_publish(publisher, &message, nullptr));
+  EXPECT_EQ(RMW_RET_OK, rmw_publish(publisher, &message, nullptr));
+  EXPECT_EQ(2U, skipped_publish_count(publisher));
+
+  auto subscription = create_subscription(rmw_qos_profile_default);
+  ASSERT_NE(nullptr, subscription) << rmw_get_error_string().str;
+  RmwRouDiEnvironment::instance().discover();
+
+  // the skipped messages are lost, a matched publisher publishes again
+  message.int32_value = 2;
+  ASSERT_EQ(RMW_RET_OK, rmw_publish(publisher, &message, nullptr));
+  EXPECT_EQ(2U, skipped_publish_count(publisher));
+  ASSERT_EQ(RMW_RET_OK, RmwRouDiEnvironment::wait_for(wait_set_, subscription));
+
+  test_msgs::msg::BasicTypes received;
+  bool taken = false;
+  ASSERT_EQ(RMW_RET_OK, rmw_take(subscription, &received, &taken, nullptr));
+  ASSERT_TRUE(taken);
+  EXPECT_EQ(2, received.int32_value);
+  ASSERT_EQ(RMW_RET_OK, rmw_take(subscription, &received, &taken, nullptr));
+  EXPECT_FALSE(taken);
+}
+
+TEST_F(PublishTest, publisher_with_history_publishes_without_subscription)
+{
+  auto qos = rmw_qos_profile_default;
+  qos.durability = RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL;
+  qos.depth = 1U;
+  auto publisher = create_publisher(qos);
+  ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+
+  test_msgs::msg::BasicTypes message;
+  message.int32_value = 42;
+  ASSERT_EQ(RMW_RET_OK, rmw_publish(publisher, &message, nullptr));
+  EXPECT_EQ(0U, skipped_publish_count(publisher));
+
+  // a late-joining subscription gets the message from the history of the publisher
+  auto subscription = create_subscription(qos);
+  ASSERT_NE(nullptr, subscription) << rmw_get_error_string().str;
+  RmwRouDiEnvironment::instance().discover();
+  ASSERT_EQ(RMW_RET_OK, RmwRouDiEnvironment::wait_for(wait_set_, subscription));
+
+  test_msgs::msg::BasicTypes received;
+  bool taken = false;
+  ASSERT_EQ(RMW_RET_OK, rmw_take(subscription, &received, &taken, nullptr));
+  ASSERT_TRUE(taken);
+  EXPECT_EQ(42, received.int32_value);
+}
+
+TEST_F(PublishTest, expired_messages_are_not_taken)
+{
+  auto qos = rmw_qos_profile_default;
+  qos.lifespan = rmw_time_t{0U, 50000000U};
+  auto publisher = create_publisher(qos);
+  ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+  auto subscription = create_subscription(qos);
+  ASSERT_NE(nullptr, subscription) << rmw_get_error_string().str;
+  RmwRouDiEnvironment::instance().discover();
+
+  test_msgs::msg::BasicTypes message;
+  message.int32_value = 1;
+  ASSERT_EQ(RMW_RET_OK, rmw_publish(publisher, &message, nullptr));
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  message.int32_value = 2;
+  ASSERT_EQ(RMW_RET_OK, rmw_publish(publisher, &message, nullptr));
+
+  // the first message outlived its lifespan while it was queued
+  test_msgs::msg::BasicTypes received;
+  bool taken = false;
+  ASSERT_EQ(RMW_RET_OK, rmw_take(subscription, &received, &taken, nullptr));
+  ASSERT_TRUE(taken);
+  EXPECT_EQ(2, received.int32_value);
+  ASSERT_EQ(RMW_RET_OK, rmw_take(subscription, &received, &taken, nullptr));
+  EXPECT_FALSE(taken);
+}
+
+TEST_F(PublishTest, clock_is_only_read_for_timed_qos)
+{
+  auto timed_qos = rmw_qos_profile_default;
+  timed_qos.lifespan = rmw_time_t{10U, 0U};
+  auto untimed_publisher = create_publisher(rmw_qos_profile_default);
+  ASSERT_NE(nullptr, untimed_publisher) << rmw_get_error_string().str;
+  auto timed_publisher = create_publisher(timed_qos);
+  ASSERT_NE(nullptr, timed_publisher) << rmw_get_error_string().str;
+  auto subscription = create_subscription(rmw_qos_profile_default);
+  ASSERT_NE(nullptr, subscription) << rmw_get_error_string().str;
+  RmwRouDiEnvironment::instance().discover();
+
+  test_msgs::msg::BasicTypes message;
+  for (auto publisher : {untimed_publisher, timed_publisher}) {
+    ASSERT_EQ(RMW_RET_OK, rmw_publish(publisher, &message, nullptr));
+    ASSERT_EQ(RMW_RET_OK, RmwRouDiEnvironment::wait_for(wait_set_, subscription));
+
+    void * loaned_message = nullptr;
+    bool taken = false;
+    ASSERT_EQ(
+      RMW_RET_OK, rmw_take_loaned_message(subscription, &loaned_message, &taken, nullptr));
+    ASSERT_TRUE(taken);
+    auto user_header = get_iceoryx_user_header(loaned_message);
+    ASSERT_NE(nullptr, user_header);
+    if (publisher == untimed_publisher) {
+      EXPECT_EQ(0, user_header->source_timestamp_);
+      EXPECT_EQ(0, user_header->expiry_timestamp_);
+    } else {
+      EXPECT_NE(0, user_header->source_timestamp_);
+      EXPECT_EQ(user_header->source_timestamp_ + 10000000000, user_header->expiry_timestamp_);
+    }
+    EXPECT_EQ(
+      RMW_RET_OK, rmw_return_loaned_message_from_subscription(subscription, loaned_message));
+  }
+}
+
+TEST_F(PublishTest, user_header_of_non_ros_publisher_is_ignored)
+{
+  auto subscription = create_subscription(rmw_qos_profile_default);
+  ASSERT_NE(nullptr, subscription) << rmw_get_error_string().str;
+
+  // a user header of the same size as the one of rmw_iceoryx_cpp, every field of which would
+  // mark the chunk as long expired
+  struct ForeignUserHeader
+  {
+    int64_t values_[3] = {1, 1, 1};
+  };
+  iox::popo::UntypedPublisher iceoryx_sender(
+    rmw_iceoryx_cpp::get_iceoryx_service_description(topic_name_, type_support()));
+  RmwRouDiEnvironment::instance().discover();
+
+  test_msgs::msg::BasicTypes message;
+  message.int32_value = 42;
+  iceoryx_sender.loan(
+    sizeof(message), alignof(test_msgs::msg::BasicTypes),
+    sizeof(ForeignUserHeader), alignof(ForeignUserHeader))
+  .and_then(
+    [&](void * user_payload) {
+      new (iox::mepoo::ChunkHeader::fromUserPayload(user_payload)->userHeader())
+      ForeignUserHeader();
+      new (user_payload) test_msgs::msg::BasicTypes(message);
+      iceoryx_sender.publish(user_payload);
+    })
+  .or_else([](auto) {FAIL() << "failed to loan a chunk";});
+  ASSERT_EQ(RMW_RET_OK, RmwRouDiEnvironment::wait_for(wait_set_, subscription));
+
+  test_msgs::msg::BasicTypes received;
+  bool taken = false;
+  ASSERT_EQ(RMW_RET_OK, rmw_take(subscription, &received, &taken, nullptr));
+  ASSERT_TRUE(taken);
+  EXPECT_EQ(42, received.int32_value);
+}
+
+TEST_F(PublishTest, silent_publisher_misses_offered_deadline)
+{
+  auto qos = rmw_qos_profile_default;
+  qos.deadline = rmw_time_t{0U, 10000000U};
+  auto publisher = create_publisher(qos);
+  ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+  auto event = rmw_get_zero_initialized_event();
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_publisher_event_init(&event, publisher, RMW_EVENT_OFFERED_DEADLINE_MISSED));
+
+  ASSERT_EQ(RMW_RET_OK, RmwRouDiEnvironment::wait_for(wait_set_, &event));
+  rmw_offered_deadline_missed_status_t status{};
+  bool taken = false;
+  ASSERT_EQ(RMW_RET_OK, rmw_take_event(&event, &status, &taken));
+  ASSERT_TRUE(taken);
+  EXPECT_GE(status.total_count, 1);
+  EXPECT_EQ(status.total_count, status.total_count_change);
+
+  // the change is reset once it is taken
+  ASSERT_EQ(RMW_RET_OK, rmw_take_event(&event, &status, &taken));
+  EXPECT_GE(status.total_count, 1);
+  EXPECT_EQ(0, status.total_count_change);
+  EXPECT_EQ(RMW_RET_OK, rmw_event_fini(&event));
+}
+
+TEST_F(PublishTest, subscription_without_messages_misses_requested_deadline)
+{
+  auto qos = rmw_qos_profile_default;
+  qos.deadline = rmw_time_t{0U, 10000000U};
+  auto publisher = create_publisher(qos);
+  ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+  auto subscription = create_subscription(qos);
+  ASSERT_NE(nullptr, subscription) << rmw_get_error_string().str;
+  auto event = rmw_get_zero_initialized_event();
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_subscription_event_init(&event, subscription, RMW_EVENT_REQUESTED_DEADLINE_MISSED));
+  RmwRouDiEnvironment::instance().discover();
+
+  test_msgs::msg::BasicTypes message;
+  ASSERT_EQ(RMW_RET_OK, rmw_publish(publisher, &message, nullptr));
+  test_msgs::msg::BasicTypes received;
+  bool taken = false;
+  ASSERT_EQ(RMW_RET_OK, RmwRouDiEnvironment::wait_for(wait_set_, subscription));
+  ASSERT_EQ(RMW_RET_OK, rmw_take(subscription, &received, &taken, nullptr));
+  ASSERT_TRUE(taken);
+
+  // no further message arrives within the deadline
+  ASSERT_EQ(RMW_RET_OK, RmwRouDiEnvironment::wait_for(wait_set_, &event));
+  rmw_requested_deadline_missed_status_t status{};
+  ASSERT_EQ(RMW_RET_OK, rmw_take_event(&event, &status, &taken));
+  ASSERT_TRUE(taken);
+  EXPECT_GE(status.total_count, 1);
+  EXPECT_EQ(RMW_RET_OK, rmw_event_fini(&event));
+}
+
+TEST_F(PublishTest, silent_manual_by_topic_publisher_loses_liveliness)
+{
+  auto qos = rmw_qos_profile_default;
+  qos.liveliness = RMW_QOS_POLICY_LIVELINESS_MANUAL_BY_TOPIC;
+  qos.liveliness_lease_duration = rmw_time_t{0U, 10000000U};
+  auto publisher = create_publisher(qos);
+  ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+  auto event = rmw_get_zero_initialized_event();
+  ASSERT_EQ(RMW_RET_OK, rmw_publisher_event_init(&event, publisher, RMW_EVENT_LIVELINESS_LOST));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  ASSERT_EQ(RMW_RET_OK, RmwRouDiEnvironment::wait_for(wait_set_, &event));
+  rmw_liveliness_lost_status_t status{};
+  bool taken = false;
+  ASSERT_EQ(RMW_RET_OK, rmw_take_event(&event, &status, &taken));
+  ASSERT_TRUE(taken);
+  EXPECT_EQ(1, status.total_count);
+  EXPECT_EQ(1, status.total_count_change);
+  EXPECT_EQ(RMW_RET_OK, rmw_event_fini(&event));
+}
+
+TEST_F(PublishTest, new_publisher_wakes_up_liveliness_changed_event)
+{
+  auto subscription = create_subscription(rmw_qos_profile_default);
+  ASSERT_NE(nullptr, subscription) << rmw_get_error_string().str;
+  auto event = rmw_get_zero_initialized_event();
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_subscription_event_init(&event, subscription, RMW_EVENT_LIVELINESS_CHANGED));
+  rmw_liveliness_changed_status_t status{};
+  bool taken = false;
+  ASSERT_EQ(RMW_RET_OK, rmw_take_event(&event, &status, &taken));
+  EXPECT_EQ(0, status.alive_count);
+
+  // the wait is not polled, it returns because the graph change notifier triggers it
+  auto publisher = create_publisher(rmw_qos_profile_default);
+  ASSERT_NE(nullptr, publisher) << rmw_get_error_string().str;
+  RmwRouDiEnvironment::instance().discover();
+  ASSERT_EQ(RMW_RET_OK, RmwRouDiEnvironment::wait_for(wait_set_, &event, rmw_time_t{5U, 0U}));
+
+  ASSERT_EQ(RMW_RET_OK, rmw_take_event(&event, &status, &taken));
+  ASSERT_TRUE(taken);
+  EXPECT_EQ(1, status.alive_count);
+  EXPECT_EQ(1, status.alive_count_change);
+  EXPECT_EQ(0, status.not_alive_count);
+  EXPECT_EQ(RMW_RET_OK, rmw_event_fini(&event));
+}
@@ -0,0 +1,229 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "rmw_iceoryx_cpp/iceoryx_qos.hpp"
+
+namespace
+{
+/// @brief The default profile with the SYSTEM_DEFAULT liveliness resolved, as reported for the
+///        endpoints of the graph
+rmw_qos_profile_t resolved_qos_profile()
+{
+  auto qos = rmw_qos_profile_default;
+  qos.liveliness = RMW_QOS_POLICY_LIVELINESS_AUTOMATIC;
+  return qos;
+}
+}  // namespace
+
+TEST(QosTests, default_profile_maps_to_non_blocking_volatile_options)
+{
+  auto publisher_options =
+    rmw_iceoryx_cpp::get_iceoryx_publisher_options(rmw_qos_profile_default, "/ns/node");
+  EXPECT_EQ(0U, publisher_options.historyCapacity);
+  EXPECT_EQ(
+    iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+    publisher_options.subscriberTooSlowPolicy);
+  EXPECT_EQ(std::string("/ns/node"), publisher_options.nodeName.c_str());
+
+  auto subscriber_options =
+    rmw_iceoryx_cpp::get_iceoryx_subscriber_options(rmw_qos_profile_default, "/ns/node");
+  EXPECT_EQ(rmw_qos_profile_default.depth, subscriber_options.queueCapacity);
+  EXPECT_EQ(0U, subscriber_options.historyRequest);
+  EXPECT_FALSE(subscriber_options.requiresPublisherHistorySupport);
+  EXPECT_EQ(iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA, subscriber_options.queueFullPolicy);
+}
+
+TEST(QosTests, reliable_keep_all_maps_to_a_blocking_publisher_only)
+{
+  auto qos = rmw_qos_profile_default;
+  qos.history = RMW_QOS_POLICY_HISTORY_KEEP_ALL;
+  qos.reliability = RMW_QOS_POLICY_RELIABILITY_RELIABLE;
+
+  auto publisher_options = rmw_iceoryx_cpp::get_iceoryx_publisher_options(qos, "");
+  EXPECT_EQ(
+    iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER,
+    publisher_options.subscriberTooSlowPolicy);
+
+  auto subscriber_options = rmw_iceoryx_cpp::get_iceoryx_subscriber_options(qos, "");
+  EXPECT_EQ(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY, subscriber_options.queueCapacity);
+  // a blocking subscriber would not be connected to publishers which discard
+  EXPECT_EQ(iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA, subscriber_options.queueFullPolicy);
+}
+
+TEST(QosTests, transient_local_maps_to_history)
+{
+  auto qos = rmw_qos_profile_default;
+  qos.durability = RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL;
+  qos.depth = 5U;
+
+  auto publisher_options = rmw_iceoryx_cpp::get_iceoryx_publisher_options(qos, "");
+  EXPECT_EQ(5U, publisher_options.historyCapacity);
+
+  auto subscriber_options = rmw_iceoryx_cpp::get_iceoryx_subscriber_options(qos, "");
+  EXPECT_EQ(5U, subscriber_options.historyRequest);
+  EXPECT_TRUE(subscriber_options.requiresPublisherHistorySupport);
+}
+
+TEST(QosTests, depth_is_clamped_to_iceoryx_capacities)
+{
+  auto qos = rmw_qos_profile_default;
+  qos.durability = RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL;
+  qos.depth = iox::MAX_SUBSCRIBER_QUEUE_CAPACITY + 1U;
+
+  auto publisher_options = rmw_iceoryx_cpp::get_iceoryx_publisher_options(qos, "");
+  EXPECT_EQ(iox::MAX_PUBLISHER_HISTORY, publisher_options.historyCapacity);
+
+  auto subscriber_options = rmw_iceoryx_cpp::get_iceoryx_subscriber_options(qos, "");
+  EXPECT_EQ(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY, subscriber_options.queueCapacity);
+}
+
+TEST(QosTests, resolved_default_profiles_are_compatible)
+{
+  std::string reason;
+  EXPECT_EQ(
+    RMW_QOS_COMPATIBILITY_OK,
+    rmw_iceoryx_cpp::check_qos_compatibility(
+      resolved_qos_profile(), resolved_qos_profile(), reason));
+  EXPECT_TRUE(reason.empty());
+}
+
+TEST(QosTests, best_effort_publisher_and_reliable_subscription_are_incompatible)
+{
+  auto publisher_qos = resolved_qos_profile();
+  publisher_qos.reliability = RMW_QOS_POLICY_RELIABILITY_BEST_EFFORT;
+
+  std::string reason;
+  EXPECT_EQ(
+    RMW_QOS_COMPATIBILITY_ERROR,
+    rmw_iceoryx_cpp::check_qos_compatibility(publisher_qos, resolved_qos_profile(), reason));
+  EXPECT_FALSE(reason.empty());
+}
+
+TEST(QosTests, keep_all_subscription_is_a_warning)
+{
+  auto subscription_qos = resolved_qos_profile();
+  subscription_qos.history = RMW_QOS_POLICY_HISTORY_KEEP_ALL;
+
+  std::string reason;
+  EXPECT_EQ(
+    RMW_QOS_COMPATIBILITY_WARNING,
+    rmw_iceoryx_cpp::check_qos_compatibility(resolved_qos_profile(), subscription_qos, reason));
+  EXPECT_FALSE(reason.empty());
+}
+
+TEST(QosTests, unresolved_policies_are_a_warning)
+{
+  auto publisher_qos = resolved_qos_profile();
+  publisher_qos.reliability = RMW_QOS_POLICY_RELIABILITY_SYSTEM_DEFAULT;
+
+  std::string reason;
+  EXPECT_EQ(
+    RMW_QOS_COMPATIBILITY_WARNING,
+    rmw_iceoryx_cpp::check_qos_compatibility(publisher_qos, resolved_qos_profile(), reason));
+
+  auto subscription_qos = resolved_qos_profile();
+  subscription_qos.durability = RMW_QOS_POLICY_DURABILITY_UNKNOWN;
+  EXPECT_EQ(
+    RMW_QOS_COMPATIBILITY_WARNING,
+    rmw_iceoryx_cpp::check_qos_compatibility(resolved_qos_profile(), subscription_qos, reason));
+
+  publisher_qos = resolved_qos_profile();
+  publisher_qos.liveliness = RMW_QOS_POLICY_LIVELINESS_UNKNOWN;
+  subscription_qos = resolved_qos_profile();
+  subscription_qos.liveliness = RMW_QOS_POLICY_LIVELINESS_MANUAL_BY_TOPIC;
+  EXPECT_EQ(
+    RMW_QOS_COMPATIBILITY_WARNING,
+    rmw_iceoryx_cpp::check_qos_compatibility(publisher_qos, subscription_qos, reason));
+}
+
+TEST(QosTests, blocking_publisher_and_discarding_subscription_are_compatible)
+{
+  auto publisher_qos = resolved_qos_profile();
+  publisher_qos.history = RMW_QOS_POLICY_HISTORY_KEEP_ALL;
+
+  std::string reason;
+  EXPECT_EQ(
+    RMW_QOS_COMPATIBILITY_OK,
+    rmw_iceoryx_cpp::check_qos_compatibility(publisher_qos, resolved_qos_profile(), reason));
+  EXPECT_TRUE(reason.empty());
+}
+
+TEST(QosTests, volatile_publisher_and_transient_local_subscription_are_incompatible)
+{
+  auto subscription_qos = resolved_qos_profile();
+  subscription_qos.durability = RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL;
+
+  std::string reason;
+  EXPECT_EQ(
+    RMW_QOS_COMPATIBILITY_ERROR,
+    rmw_iceoryx_cpp::check_qos_compatibility(resolved_qos_profile(), subscription_qos, reason));
+}
+
+TEST(QosTests, insufficient_publisher_history_is_a_warning)
+{
+  auto publisher_qos = resolved_qos_profile();
+  publisher_qos.durability = RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL;
+  publisher_qos.depth = 1U;
+  auto subscription_qos = publisher_qos;
+  subscription_qos.depth = 5U;
+
+  std::string reason;
+  EXPECT_EQ(
+    RMW_QOS_COMPATIBILITY_WARNING,
+    rmw_iceoryx_cpp::check_qos_compatibility(publisher_qos, subscription_qos, reason));
+}
+
+TEST(QosTests, subscription_depth_above_queue_capacity_is_a_warning)
+{
+  auto subscription_qos = resolved_qos_profile();
+  subscription_qos.depth = iox::MAX_SUBSCRIBER_QUEUE_CAPACITY + 1U;
+
+  std::string reason;
+  EXPECT_EQ(
+    RMW_QOS_COMPATIBILITY_WARNING,
+    rmw_iceoryx_cpp::check_qos_compatibility(resolved_qos_profile(), subscription_qos, reason));
+}
+
+TEST(QosTests, shorter_requested_deadline_is_incompatible)
+{
+  auto publisher_qos = resolved_qos_profile();
+  publisher_qos.deadline = {1, 0};
+  auto subscription_qos = resolved_qos_profile();
+  subscription_qos.deadline = {0, 500000000};
+
+  std::string reason;
+  EXPECT_EQ(
+    RMW_QOS_COMPATIBILITY_ERROR,
+    rmw_iceoryx_cpp::check_qos_compatibility(publisher_qos, subscription_qos, reason));
+  EXPECT_EQ(
+    RMW_QOS_COMPATIBILITY_OK,
+    rmw_iceoryx_cpp::check_qos_compatibility(subscription_qos, publisher_qos, reason));
+}
+
+TEST(QosTests, automatic_publisher_and_manual_subscription_are_incompatible)
+{
+  auto publisher_qos = resolved_qos_profile();
+  publisher_qos.liveliness = RMW_QOS_POLICY_LIVELINESS_AUTOMATIC;
+  auto subscription_qos = resolved_qos_profile();
+  subscription_qos.liveliness = RMW_QOS_POLICY_LIVELINESS_MANUAL_BY_TOPIC;
+
+  std::string reason;
+  EXPECT_EQ(
+    RMW_QOS_COMPATIBILITY_ERROR,
+    rmw_iceoryx_cpp::check_qos_compatibility(publisher_qos, subscription_qos, reason));
+}
@@ -0,0 +1,101 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <initializer_list>
+
+#include "../src/types/iceoryx_client.hpp"
+
+namespace
+{
+constexpr int64_t CAPACITY{static_cast<int64_t>(IceoryxRequestWindow::MIN_CAPACITY)};
+}  // namespace
+
+TEST(RequestWindowTest, request_in_flight_is_removed_once)
+{
+  IceoryxRequestWindow window(IceoryxRequestWindow::MIN_CAPACITY);
+  window.insert(0);
+
+  EXPECT_TRUE(window.remove(0));
+  EXPECT_FALSE(window.remove(0));
+}
+
+TEST(RequestWindowTest, responses_are_accepted_out_of_order)
+{
+  IceoryxRequestWindow window(IceoryxRequestWindow::MIN_CAPACITY);
+  for (int64_t sequence_id = 1; sequence_id <= 10; ++sequence_id) {
+    window.insert(sequence_id);
+  }
+
+  for (int64_t sequence_id : {7, 2, 10, 1, 5, 3, 9, 4, 8, 6}) {
+    EXPECT_TRUE(window.remove(sequence_id)) << "sequence id " << sequence_id;
+  }
+  for (int64_t sequence_id = 1; sequence_id <= 10; ++sequence_id) {
+    EXPECT_FALSE(window.remove(sequence_id)) << "sequence id " << sequence_id;
+  }
+}
+
+TEST(RequestWindowTest, unknown_sequence_is_rejected)
+{
+  IceoryxRequestWindow window(IceoryxRequestWindow::MIN_CAPACITY);
+  EXPECT_FALSE(window.remove(0));
+  EXPECT_FALSE(window.remove(-1));
+
+  window.insert(3);
+  EXPECT_FALSE(window.remove(4));
+  // the sequence id which shares the slot of an in flight one is still unknown
+  EXPECT_FALSE(window.remove(3 + CAPACITY));
+  EXPECT_TRUE(window.remove(3));
+}
+
+TEST(RequestWindowTest, sequence_ids_wrap_around_the_slots)
+{
+  IceoryxRequestWindow window(IceoryxRequestWindow::MIN_CAPACITY);
+  for (int64_t round = 0; round < 3; ++round) {
+    for (int64_t i = 0; i < CAPACITY; ++i) {
+      window.insert(round * CAPACITY + i);
+    }
+    for (int64_t i = 0; i < CAPACITY; ++i) {
+      EXPECT_TRUE(window.remove(round * CAPACITY + i)) << "round " << round << " slot " << i;
+    }
+  }
+}
+
+TEST(RequestWindowTest, full_window_evicts_the_oldest_request)
+{
+  IceoryxRequestWindow window(IceoryxRequestWindow::MIN_CAPACITY);
+  for (int64_t sequence_id = 0; sequence_id <= CAPACITY; ++sequence_id) {
+    window.insert(sequence_id);
+  }
+
+  // the late response of the evicted request is stale
+  EXPECT_FALSE(window.remove(0));
+  EXPECT_TRUE(window.remove(CAPACITY));
+  for (int64_t sequence_id = 1; sequence_id < CAPACITY; ++sequence_id) {
+    EXPECT_TRUE(window.remove(sequence_id)) << "sequence id " << sequence_id;
+  }
+}
+
+TEST(RequestWindowTest, capacity_is_at_least_the_minimum)
+{
+  IceoryxRequestWindow window(1U);
+  for (int64_t sequence_id = 0; sequence_id < CAPACITY; ++sequence_id) {
+    window.insert(sequence_id);
+  }
+  for (int64_t sequence_id = 0; sequence_id < CAPACITY; ++sequence_id) {
+    EXPECT_TRUE(window.remove(sequence_id)) << "sequence id " << sequence_id;
+  }
+}
@@ -17,16 +17,22 @@
 
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 #include "rosidl_typesupport_cpp/message_type_support.hpp"
+#include "rosidl_typesupport_cpp/service_type_support.hpp"
 
 #include "rosidl_typesupport_introspection_cpp/identifier.hpp"
 #include "rosidl_typesupport_introspection_cpp/message_introspection.hpp"
 
 #include "test_msgs/message_fixtures.hpp"
+#include "test_msgs/srv/arrays.hpp"
+#include "test_msgs/srv/basic_types.hpp"
+#include "test_msgs/srv/empty.hpp"
 
 #include "./test_msgs_c_fixtures.hpp"
 
@@ -245,3 +251,130 @@ TEST(SerializationTests, c_flip_flop_serialize_builtins)
   auto ts = ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, Builtins);
   flip_flop_serialization<test_msgs__msg__Builtins>(std::bind(&get_messages_builtins_c), ts);
 }
+
+/// @brief Serializing into a buffer of the computed size must succeed and into a smaller one must
+///        fail, i.e. the computed size is exactly the number of bytes written. Chunks are loaned
+///        with the computed size, hence the serialization relies on it.
+template<class SerializeF>
+void expect_exact_serialized_size(size_t serialized_size, SerializeF serialize_into)
+{
+  std::vector<char> buffer(serialized_size);
+  EXPECT_NO_THROW(serialize_into(buffer.data(), buffer.size()));
+  if (serialized_size > 0U) {
+    EXPECT_THROW(serialize_into(buffer.data(), buffer.size() - 1U), std::runtime_error);
+  }
+}
+
+template<
+  class MessageT,
+  class MessageFixtureF = std::function<std::vector<std::shared_ptr<MessageT>>(void)>
+>
+void serialized_size_is_exact(
+  MessageFixtureF message_fixture,
+  const rosidl_message_type_support_t * ts)
+{
+  auto test_msgs = message_fixture();
+  for (auto i = 0u; i < test_msgs.size(); ++i) {
+    SCOPED_TRACE("message #" + std::to_string(i));
+    const MessageT * msg = test_msgs[i].get();
+    expect_exact_serialized_size(
+      rmw_iceoryx_cpp::get_serialized_size(msg, ts),
+      [&](char * buffer, size_t buffer_size) {
+        rmw_iceoryx_cpp::serialize(msg, ts, buffer, buffer_size);
+      });
+  }
+}
+
+template<class MessageT>
+void serialized_size_is_exact(
+  std::function<std::vector<std::shared_ptr<MessageT>>(void)> message_fixture)
+{
+  serialized_size_is_exact<MessageT>(
+    message_fixture, rosidl_typesupport_cpp::get_message_type_support_handle<MessageT>());
+}
+
+template<class ServiceT>
+void serialized_service_sizes_are_exact(
+  const typename ServiceT::Request & request,
+  const typename ServiceT::Response & response)
+{
+  auto ts = rosidl_typesupport_cpp::get_service_type_support_handle<ServiceT>();
+  {
+    SCOPED_TRACE("request");
+    expect_exact_serialized_size(
+      rmw_iceoryx_cpp::get_serialized_request_size(&request, ts),
+      [&](char * buffer, size_t buffer_size) {
+        rmw_iceoryx_cpp::serializeRequest(&request, ts, buffer, buffer_size);
+      });
+  }
+  {
+    SCOPED_TRACE("response");
+    expect_exact_serialized_size(
+      rmw_iceoryx_cpp::get_serialized_response_size(&response, ts),
+      [&](char * buffer, size_t buffer_size) {
+        rmw_iceoryx_cpp::serializeResponse(&response, ts, buffer, buffer_size);
+      });
+  }
+}
+
+TEST(SerializationTests, cpp_serialized_size_is_exact)
+{
+  serialized_size_is_exact<test_msgs::msg::Empty>(&get_messages_empty);
+  serialized_size_is_exact<test_msgs::msg::BasicTypes>(&get_messages_basic_types);
+  serialized_size_is_exact<test_msgs::msg::Constants>(&get_messages_constants);
+  serialized_size_is_exact<test_msgs::msg::Defaults>(&get_messages_defaults);
+  serialized_size_is_exact<test_msgs::msg::Strings>(&get_messages_strings);
+  serialized_size_is_exact<test_msgs::msg::Arrays>(&get_messages_arrays);
+  serialized_size_is_exact<test_msgs::msg::UnboundedSequences>(
+    &get_messages_unbounded_sequences);
+  serialized_size_is_exact<test_msgs::msg::BoundedSequences>(&get_messages_bounded_sequences);
+  serialized_size_is_exact<test_msgs::msg::MultiNested>(&get_messages_multi_nested);
+  serialized_size_is_exact<test_msgs::msg::Nested>(&get_messages_nested);
+  serialized_size_is_exact<test_msgs::msg::Builtins>(&get_messages_builtins);
+}
+
+TEST(SerializationTests, c_serialized_size_is_exact)
+{
+  serialized_size_is_exact<test_msgs__msg__Empty>(
+    &get_messages_empty_c, ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, Empty));
+  serialized_size_is_exact<test_msgs__msg__BasicTypes>(
+    &get_messages_basic_types_c, ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes));
+  serialized_size_is_exact<test_msgs__msg__Constants>(
+    &get_messages_constants_c, ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, Constants));
+  serialized_size_is_exact<test_msgs__msg__Defaults>(
+    &get_messages_defaults_c, ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, Defaults));
+  serialized_size_is_exact<test_msgs__msg__Strings>(
+    &get_messages_strings_c, ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, Strings));
+  serialized_size_is_exact<test_msgs__msg__Arrays>(
+    &get_messages_arrays_c, ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, Arrays));
+  serialized_size_is_exact<test_msgs__msg__UnboundedSequences>(
+    &get_messages_unbounded_sequences_c,
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, UnboundedSequences));
+  serialized_size_is_exact<test_msgs__msg__BoundedSequences>(
+    &get_messages_bounded_sequences_c,
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BoundedSequences));
+  serialized_size_is_exact<test_msgs__msg__MultiNested>(
+    &get_messages_multi_nested_c, ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, MultiNested));
+  serialized_size_is_exact<test_msgs__msg__Nested>(
+    &get_messages_nested_c, ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, Nested));
+  serialized_size_is_exact<test_msgs__msg__Builtins>(
+    &get_messages_builtins_c, ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, Builtins));
+}
+
+TEST(SerializationTests, serialized_request_and_response_sizes_are_exact)
+{
+  serialized_service_sizes_are_exact<test_msgs::srv::Empty>({}, {});
+
+  test_msgs::srv::BasicTypes::Request basic_types_request;
+  basic_types_request.string_value = "request";
+  test_msgs::srv::BasicTypes::Response basic_types_response;
+  basic_types_response.string_value = std::string(300U, 'x');
+  serialized_service_sizes_are_exact<test_msgs::srv::BasicTypes>(
+    basic_types_request, basic_types_response);
+
+  test_msgs::srv::Arrays::Request arrays_request;
+  arrays_request.string_values[0] = std::string(256U, 'x');
+  arrays_request.string_values[2] = "three";
+  serialized_service_sizes_are_exact<test_msgs::srv::Arrays>(
+    arrays_request, test_msgs::srv::Arrays::Response{});
+}
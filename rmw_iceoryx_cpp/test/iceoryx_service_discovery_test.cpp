@@ -0,0 +1,127 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+
+#include "rmw_iceoryx_cpp/iceoryx_service_discovery.hpp"
+
+namespace
+{
+iox::capro::ServiceDescription make_service_description(const char * type, const char * name)
+{
+  return iox::capro::ServiceDescription(
+    iox::capro::IdString_t(iox::cxx::TruncateToCapacity, type),
+    iox::capro::IdString_t(iox::cxx::TruncateToCapacity, name),
+    iox::capro::IdString_t(iox::cxx::TruncateToCapacity, "data"));
+}
+}  // namespace
+
+using rmw_iceoryx_cpp::ServiceEndpointKind;
+
+TEST(ServiceDiscoveryTests, endpoints_are_attributed_to_their_node)
+{
+  auto add_ints = make_service_description("AddTwoInts", "/add_two_ints");
+  auto set_bool = make_service_description("SetBool", "/set_bool");
+
+  rmw_iceoryx_cpp::register_service_endpoint(
+    ServiceEndpointKind::SERVER, add_ints, "server", "/ns");
+  rmw_iceoryx_cpp::register_service_endpoint(
+    ServiceEndpointKind::SERVER, set_bool, "server", "/ns");
+  rmw_iceoryx_cpp::register_service_endpoint(
+    ServiceEndpointKind::CLIENT, add_ints, "client", "/ns");
+
+  EXPECT_EQ(
+    (std::map<std::string, std::string>{
+    {"/add_two_ints", "AddTwoInts"}, {"/set_bool", "SetBool"}}),
+    rmw_iceoryx_cpp::get_service_names_and_types_of_node(
+      ServiceEndpointKind::SERVER, "server", "/ns"));
+  EXPECT_TRUE(
+    rmw_iceoryx_cpp::get_service_names_and_types_of_node(
+      ServiceEndpointKind::CLIENT, "server", "/ns").empty());
+  EXPECT_EQ(
+    (std::map<std::string, std::string>{{"/add_two_ints", "AddTwoInts"}}),
+    rmw_iceoryx_cpp::get_service_names_and_types_of_node(
+      ServiceEndpointKind::CLIENT, "client", "/ns"));
+  EXPECT_EQ(
+    (std::map<std::string, std::string>{{"/add_two_ints", "AddTwoInts"}}),
+    rmw_iceoryx_cpp::get_client_service_names_and_types());
+
+  rmw_iceoryx_cpp::unregister_service_endpoint(
+    ServiceEndpointKind::SERVER, add_ints, "server", "/ns");
+  rmw_iceoryx_cpp::unregister_service_endpoint(
+    ServiceEndpointKind::SERVER, set_bool, "server", "/ns");
+  rmw_iceoryx_cpp::unregister_service_endpoint(
+    ServiceEndpointKind::CLIENT, add_ints, "client", "/ns");
+
+  EXPECT_TRUE(
+    rmw_iceoryx_cpp::get_service_names_and_types_of_node(
+      ServiceEndpointKind::SERVER, "server", "/ns").empty());
+  EXPECT_TRUE(rmw_iceoryx_cpp::get_client_service_names_and_types().empty());
+}
+
+TEST(ServiceDiscoveryTests, endpoints_of_the_same_service_are_counted)
+{
+  auto add_ints = make_service_description("AddTwoInts", "/add_two_ints");
+
+  rmw_iceoryx_cpp::register_service_endpoint(
+    ServiceEndpointKind::CLIENT, add_ints, "client", "/");
+  rmw_iceoryx_cpp::register_service_endpoint(
+    ServiceEndpointKind::CLIENT, add_ints, "client", "/");
+  rmw_iceoryx_cpp::unregister_service_endpoint(
+    ServiceEndpointKind::CLIENT, add_ints, "client", "/");
+
+  EXPECT_EQ(
+    1U,
+    rmw_iceoryx_cpp::get_service_names_and_types_of_node(
+      ServiceEndpointKind::CLIENT, "client", "/").size());
+
+  rmw_iceoryx_cpp::unregister_service_endpoint(
+    ServiceEndpointKind::CLIENT, add_ints, "client", "/");
+
+  EXPECT_TRUE(
+    rmw_iceoryx_cpp::get_service_names_and_types_of_node(
+      ServiceEndpointKind::CLIENT, "client", "/").empty());
+}
+
+TEST(ServiceDiscoveryTests, nodes_are_told_apart_by_their_namespace)
+{
+  auto add_ints = make_service_description("AddTwoInts", "/add_two_ints");
+  auto set_bool = make_service_description("SetBool", "/set_bool");
+
+  // the same name in another namespace is another node
+  rmw_iceoryx_cpp::register_service_endpoint(
+    ServiceEndpointKind::SERVER, add_ints, "node", "/ns");
+  rmw_iceoryx_cpp::register_service_endpoint(
+    ServiceEndpointKind::SERVER, set_bool, "node", "/");
+
+  EXPECT_EQ(
+    (std::map<std::string, std::string>{{"/add_two_ints", "AddTwoInts"}}),
+    rmw_iceoryx_cpp::get_service_names_and_types_of_node(
+      ServiceEndpointKind::SERVER, "node", "/ns"));
+  EXPECT_EQ(
+    (std::map<std::string, std::string>{{"/set_bool", "SetBool"}}),
+    rmw_iceoryx_cpp::get_service_names_and_types_of_node(
+      ServiceEndpointKind::SERVER, "node", "/"));
+  EXPECT_TRUE(
+    rmw_iceoryx_cpp::get_service_names_and_types_of_node(
+      ServiceEndpointKind::SERVER, "node", "/other").empty());
+
+  rmw_iceoryx_cpp::unregister_service_endpoint(
+    ServiceEndpointKind::SERVER, add_ints, "node", "/ns");
+  rmw_iceoryx_cpp::unregister_service_endpoint(
+    ServiceEndpointKind::SERVER, set_bool, "node", "/");
+}
@@ -0,0 +1,482 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include "rcutils/allocator.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/get_service_names_and_types.h"
+#include "rmw/message_sequence.h"
+#include "rmw/names_and_types.h"
+#include "rmw/rmw.h"
+
+#include "rmw_iceoryx_cpp/iceoryx_service_extensions.hpp"
+#include "rmw_iceoryx_cpp/iceoryx_statistics.hpp"
+
+#include "rosidl_typesupport_cpp/service_type_support.hpp"
+
+#include "test_msgs/srv/arrays.hpp"
+#include "test_msgs/srv/basic_types.hpp"
+
+#include "./rmw_roudi_environment.hpp"
+
+namespace
+{
+using BasicTypes = test_msgs::srv::BasicTypes;
+
+// a request which was not sent is not waited for long
+constexpr rmw_time_t SHORT_WAIT_TIMEOUT{0U, 100000000U};
+constexpr size_t MAX_DISCOVERY_ROUNDS{100U};
+}  // namespace
+
+/// @brief Requests and their headers for 'take_request_sequence', the sequence points to them
+template<size_t Capacity>
+struct RequestSequence
+{
+  RequestSequence()
+  {
+    for (size_t i = 0U; i < Capacity; ++i) {
+      data_[i] = &requests_[i];
+    }
+    sequence_.data = data_;
+    sequence_.capacity = Capacity;
+  }
+
+  BasicTypes::Request requests_[Capacity];
+  void * data_[Capacity];
+  rmw_message_sequence_t sequence_ = rmw_get_zero_initialized_message_sequence();
+  rmw_service_info_t headers_[Capacity];
+};
+
+/// @brief A service and a client of BasicTypes on a service name of their own, destroyed after
+///        every test
+class ServiceTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    static size_t test{0U};
+    service_name_ = "/service_test_" + std::to_string(test++);
+    auto & environment = RmwRouDiEnvironment::instance();
+    auto ts = rosidl_typesupport_cpp::get_service_type_support_handle<BasicTypes>();
+    service_ = rmw_create_service(environment.node(), ts, service_name_.c_str(), &service_qos_);
+    ASSERT_NE(nullptr, service_) << rmw_get_error_string().str;
+    client_ = rmw_create_client(
+      environment.node(), ts, service_name_.c_str(), &rmw_qos_profile_services_default);
+    ASSERT_NE(nullptr, client_) << rmw_get_error_string().str;
+    wait_set_ = rmw_create_wait_set(environment.context(), 1U);
+    ASSERT_NE(nullptr, wait_set_) << rmw_get_error_string().str;
+    environment.discover();
+  }
+
+  void TearDown() override
+  {
+    auto node = RmwRouDiEnvironment::instance().node();
+    if (wait_set_) {
+      EXPECT_EQ(RMW_RET_OK, rmw_destroy_wait_set(wait_set_));
+    }
+    if (client_) {
+      EXPECT_EQ(RMW_RET_OK, rmw_destroy_client(node, client_));
+    }
+    if (service_) {
+      EXPECT_EQ(RMW_RET_OK, rmw_destroy_service(node, service_));
+    }
+  }
+
+  /// @brief Send a request with 'value' and wait until the service has it
+  void send_request(int32_t value, int64_t * sequence_id = nullptr)
+  {
+    BasicTypes::Request request;
+    request.int32_value = value;
+    int64_t sent_sequence_id = -1;
+    ASSERT_EQ(RMW_RET_OK, rmw_send_request(client_, &request, &sent_sequence_id));
+    ASSERT_EQ(RMW_RET_OK, RmwRouDiEnvironment::wait_for(wait_set_, service_));
+    if (sequence_id) {
+      *sequence_id = sent_sequence_id;
+    }
+  }
+
+  /// @brief Let RouDi process the offers until the client sees the server as 'expected'
+  /// @return false if it does not within MAX_DISCOVERY_ROUNDS
+  bool server_availability_becomes(bool expected)
+  {
+    auto & environment = RmwRouDiEnvironment::instance();
+    for (size_t round = 0U; round < MAX_DISCOVERY_ROUNDS; ++round) {
+      environment.discover();
+      bool is_available = !expected;
+      EXPECT_EQ(
+        RMW_RET_OK, rmw_service_server_is_available(environment.node(), client_, &is_available));
+      if (is_available == expected) {
+        return true;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+  }
+
+  bool is_service_listed()
+  {
+    auto allocator = rcutils_get_default_allocator();
+    auto names_and_types = rmw_get_zero_initialized_names_and_types();
+    EXPECT_EQ(
+      RMW_RET_OK,
+      rmw_get_service_names_and_types(
+        RmwRouDiEnvironment::instance().node(), &allocator, &names_and_types));
+    bool listed = false;
+    for (size_t i = 0U; i < names_and_types.names.size; ++i) {
+      listed = listed || service_name_ == names_and_types.names.data[i];
+    }
+    EXPECT_EQ(RMW_RET_OK, rmw_names_and_types_fini(&names_and_types));
+    return listed;
+  }
+
+  rmw_qos_profile_t service_qos_ = rmw_qos_profile_services_default;
+  std::string service_name_;
+  rmw_service_t * service_{nullptr};
+  rmw_client_t * client_{nullptr};
+  rmw_wait_set_t * wait_set_{nullptr};
+};
+
+TEST_F(ServiceTest, take_from_an_empty_queue_takes_nothing)
+{
+  BasicTypes::Request request;
+  rmw_service_info_t request_header;
+  bool taken = true;
+  EXPECT_EQ(RMW_RET_OK, rmw_take_request(service_, &request_header, &request, &taken));
+  EXPECT_FALSE(taken);
+
+  const void * loaned_request = nullptr;
+  taken = true;
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_iceoryx_cpp::take_loaned_request(service_, &request_header, &loaned_request, &taken));
+  EXPECT_FALSE(taken);
+  EXPECT_EQ(nullptr, loaned_request);
+}
+
+TEST_F(ServiceTest, loaned_request_and_response_round_trip)
+{
+  void * loaned_request = nullptr;
+  ASSERT_EQ(RMW_RET_OK, rmw_iceoryx_cpp::borrow_loaned_request(client_, &loaned_request));
+  ASSERT_NE(nullptr, loaned_request);
+  static_cast<BasicTypes::Request *>(loaned_request)->int32_value = 42;
+  static_cast<BasicTypes::Request *>(loaned_request)->float64_value = 1.5;
+  int64_t sequence_id = -1;
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_iceoryx_cpp::send_loaned_request(client_, loaned_request, &sequence_id));
+
+  ASSERT_EQ(RMW_RET_OK, RmwRouDiEnvironment::wait_for(wait_set_, service_));
+  rmw_service_info_t request_header;
+  const void * taken_request = nullptr;
+  bool taken = false;
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_iceoryx_cpp::take_loaned_request(service_, &request_header, &taken_request, &taken));
+  ASSERT_TRUE(taken);
+  EXPECT_EQ(sequence_id, request_header.request_id.sequence_number);
+  const auto * request = static_cast<const BasicTypes::Request *>(taken_request);
+  EXPECT_EQ(42, request->int32_value);
+  EXPECT_EQ(1.5, request->float64_value);
+
+  // the taken request stays valid while the response is built
+  void * loaned_response = nullptr;
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_iceoryx_cpp::borrow_loaned_response(
+      service_, &request_header.request_id, &loaned_response));
+  ASSERT_NE(nullptr, loaned_response);
+  static_cast<BasicTypes::Response *>(loaned_response)->int32_value = request->int32_value + 1;
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_iceoryx_cpp::send_loaned_response(
+      service_, &request_header.request_id, loaned_response));
+
+  ASSERT_EQ(RMW_RET_OK, RmwRouDiEnvironment::wait_for(wait_set_, client_));
+  rmw_service_info_t response_header;
+  BasicTypes::Response response;
+  taken = false;
+  ASSERT_EQ(RMW_RET_OK, rmw_take_response(client_, &response_header, &response, &taken));
+  ASSERT_TRUE(taken);
+  EXPECT_EQ(sequence_id, response_header.request_id.sequence_number);
+  EXPECT_EQ(43, response.int32_value);
+
+  // the request was released with the response, it can't be answered twice
+  BasicTypes::Response second_response;
+  EXPECT_EQ(
+    RMW_RET_ERROR, rmw_send_response(service_, &request_header.request_id, &second_response));
+  rmw_reset_error();
+}
+
+TEST_F(ServiceTest, returned_request_is_not_sent)
+{
+  void * loaned_request = nullptr;
+  ASSERT_EQ(RMW_RET_OK, rmw_iceoryx_cpp::borrow_loaned_request(client_, &loaned_request));
+  EXPECT_EQ(RMW_RET_OK, rmw_iceoryx_cpp::return_loaned_request(client_, loaned_request));
+
+  EXPECT_EQ(
+    RMW_RET_TIMEOUT, RmwRouDiEnvironment::wait_for(wait_set_, service_, SHORT_WAIT_TIMEOUT));
+  rmw_service_info_t request_header;
+  BasicTypes::Request request;
+  bool taken = true;
+  EXPECT_EQ(RMW_RET_OK, rmw_take_request(service_, &request_header, &request, &taken));
+  EXPECT_FALSE(taken);
+}
+
+TEST_F(ServiceTest, request_is_still_answered_after_the_response_was_returned)
+{
+  BasicTypes::Request request;
+  request.int32_value = 7;
+  int64_t sequence_id = -1;
+  ASSERT_EQ(RMW_RET_OK, rmw_send_request(client_, &request, &sequence_id));
+
+  ASSERT_EQ(RMW_RET_OK, RmwRouDiEnvironment::wait_for(wait_set_, service_));
+  rmw_service_info_t request_header;
+  BasicTypes::Request received_request;
+  bool taken = false;
+  ASSERT_EQ(RMW_RET_OK, rmw_take_request(service_, &request_header, &received_request, &taken));
+  ASSERT_TRUE(taken);
+
+  void * loaned_response = nullptr;
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_iceoryx_cpp::borrow_loaned_response(
+      service_, &request_header.request_id, &loaned_response));
+  EXPECT_EQ(RMW_RET_OK, rmw_iceoryx_cpp::return_loaned_response(service_, loaned_response));
+  EXPECT_EQ(
+    RMW_RET_TIMEOUT, RmwRouDiEnvironment::wait_for(wait_set_, client_, SHORT_WAIT_TIMEOUT));
+
+  BasicTypes::Response response;
+  response.int32_value = received_request.int32_value;
+  ASSERT_EQ(RMW_RET_OK, rmw_send_response(service_, &request_header.request_id, &response));
+  ASSERT_EQ(RMW_RET_OK, RmwRouDiEnvironment::wait_for(wait_set_, client_));
+  rmw_service_info_t response_header;
+  BasicTypes::Response received_response;
+  taken = false;
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_take_response(client_, &response_header, &received_response, &taken));
+  ASSERT_TRUE(taken);
+  EXPECT_EQ(sequence_id, response_header.request_id.sequence_number);
+  EXPECT_EQ(7, received_response.int32_value);
+}
+
+TEST_F(ServiceTest, sequence_take_from_an_empty_queue_takes_nothing)
+{
+  RequestSequence<3U> requests;
+  size_t taken = 1U;
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_iceoryx_cpp::take_request_sequence(
+      service_, 3U, &requests.sequence_, requests.headers_, &taken));
+  EXPECT_EQ(0U, taken);
+  EXPECT_EQ(0U, requests.sequence_.size);
+}
+
+TEST_F(ServiceTest, sequence_take_stops_when_the_queue_runs_empty)
+{
+  send_request(1);
+  send_request(2);
+
+  RequestSequence<4U> requests;
+  size_t taken = 0U;
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_iceoryx_cpp::take_request_sequence(
+      service_, 4U, &requests.sequence_, requests.headers_, &taken));
+  EXPECT_EQ(2U, taken);
+  EXPECT_EQ(2U, requests.sequence_.size);
+  EXPECT_EQ(1, requests.requests_[0].int32_value);
+  EXPECT_EQ(2, requests.requests_[1].int32_value);
+}
+
+TEST_F(ServiceTest, sequence_take_rejects_a_count_beyond_the_sequence_capacity)
+{
+  RequestSequence<2U> requests;
+  size_t taken = 1U;
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_iceoryx_cpp::take_request_sequence(
+      service_, 3U, &requests.sequence_, requests.headers_, &taken));
+  rmw_reset_error();
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_iceoryx_cpp::take_request_sequence(
+      service_, 0U, &requests.sequence_, requests.headers_, &taken));
+  rmw_reset_error();
+}
+
+TEST_F(ServiceTest, sequence_take_pairs_every_request_with_its_header)
+{
+  constexpr size_t REQUEST_COUNT{3U};
+  int64_t sequence_ids[REQUEST_COUNT];
+  for (size_t i = 0U; i < REQUEST_COUNT; ++i) {
+    send_request(static_cast<int32_t>(10U + i), &sequence_ids[i]);
+  }
+
+  RequestSequence<REQUEST_COUNT> requests;
+  size_t taken = 0U;
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_iceoryx_cpp::take_request_sequence(
+      service_, REQUEST_COUNT, &requests.sequence_, requests.headers_, &taken));
+  ASSERT_EQ(REQUEST_COUNT, taken);
+
+  for (size_t i = 0U; i < REQUEST_COUNT; ++i) {
+    EXPECT_EQ(static_cast<int32_t>(10U + i), requests.requests_[i].int32_value);
+    EXPECT_EQ(sequence_ids[i], requests.headers_[i].request_id.sequence_number);
+
+    // the response to each header reaches the client with the matching sequence number
+    BasicTypes::Response response;
+    response.int32_value = requests.requests_[i].int32_value;
+    ASSERT_EQ(
+      RMW_RET_OK, rmw_send_response(service_, &requests.headers_[i].request_id, &response));
+    ASSERT_EQ(RMW_RET_OK, RmwRouDiEnvironment::wait_for(wait_set_, client_));
+    rmw_service_info_t response_header;
+    BasicTypes::Response received_response;
+    bool response_taken = false;
+    ASSERT_EQ(
+      RMW_RET_OK,
+      rmw_take_response(client_, &response_header, &received_response, &response_taken));
+    ASSERT_TRUE(response_taken);
+    EXPECT_EQ(sequence_ids[i], response_header.request_id.sequence_number);
+    EXPECT_EQ(static_cast<int32_t>(10U + i), received_response.int32_value);
+  }
+}
+
+TEST_F(ServiceTest, service_discovery_of_the_context_follows_the_offered_servers)
+{
+  ASSERT_TRUE(server_availability_becomes(true));
+  EXPECT_TRUE(is_service_listed());
+
+  ASSERT_EQ(RMW_RET_OK, rmw_destroy_service(RmwRouDiEnvironment::instance().node(), service_));
+  service_ = nullptr;
+  EXPECT_TRUE(server_availability_becomes(false));
+  EXPECT_FALSE(is_service_listed());
+}
+
+/// @brief A service which holds at most MAX_HELD_REQUESTS requests without a response
+class HeldRequestsServiceTest : public ServiceTest
+{
+protected:
+  static constexpr size_t MAX_HELD_REQUESTS{2U};
+
+  HeldRequestsServiceTest()
+  {
+    service_qos_.depth = MAX_HELD_REQUESTS;
+  }
+};
+
+TEST_F(HeldRequestsServiceTest, no_request_is_taken_while_all_places_are_taken)
+{
+  rmw_service_info_t request_headers[MAX_HELD_REQUESTS + 1U];
+  BasicTypes::Request request;
+  bool taken = false;
+  for (size_t i = 0U; i < MAX_HELD_REQUESTS; ++i) {
+    send_request(static_cast<int32_t>(i));
+    ASSERT_EQ(RMW_RET_OK, rmw_take_request(service_, &request_headers[i], &request, &taken));
+    ASSERT_TRUE(taken);
+  }
+
+  // a full table is no error, the request waits in the queue for a response to be sent
+  send_request(7);
+  taken = true;
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_take_request(service_, &request_headers[MAX_HELD_REQUESTS], &request, &taken));
+  EXPECT_FALSE(taken);
+
+  BasicTypes::Response response;
+  ASSERT_EQ(RMW_RET_OK, rmw_send_response(service_, &request_headers[0].request_id, &response));
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_take_request(service_, &request_headers[MAX_HELD_REQUESTS], &request, &taken));
+  ASSERT_TRUE(taken);
+  EXPECT_EQ(7, request.int32_value);
+}
+
+TEST_F(HeldRequestsServiceTest, sequence_take_stops_when_all_places_are_taken)
+{
+  rmw_service_info_t request_header;
+  BasicTypes::Request request;
+  bool single_taken = false;
+  send_request(1);
+  ASSERT_EQ(RMW_RET_OK, rmw_take_request(service_, &request_header, &request, &single_taken));
+  ASSERT_TRUE(single_taken);
+  send_request(2);
+  send_request(3);
+
+  // one place is left, the other request stays in the queue
+  RequestSequence<3U> requests;
+  size_t taken = 0U;
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_iceoryx_cpp::take_request_sequence(
+      service_, 3U, &requests.sequence_, requests.headers_, &taken));
+  ASSERT_EQ(1U, taken);
+  EXPECT_EQ(1U, requests.sequence_.size);
+  EXPECT_EQ(2, requests.requests_[0].int32_value);
+
+  BasicTypes::Response response;
+  ASSERT_EQ(RMW_RET_OK, rmw_send_response(service_, &request_header.request_id, &response));
+  ASSERT_EQ(
+    RMW_RET_OK,
+    rmw_iceoryx_cpp::take_request_sequence(
+      service_, 3U, &requests.sequence_, requests.headers_, &taken));
+  ASSERT_EQ(1U, taken);
+  EXPECT_EQ(3, requests.requests_[0].int32_value);
+}
+
+TEST_F(HeldRequestsServiceTest, oldest_request_is_evicted_if_configured)
+{
+  ASSERT_EQ(RMW_RET_OK, rmw_iceoryx_cpp::set_held_request_reclamation(service_, 0, true));
+
+  rmw_service_info_t request_header;
+  BasicTypes::Request request;
+  bool taken = false;
+  for (size_t i = 0U; i <= MAX_HELD_REQUESTS; ++i) {
+    send_request(static_cast<int32_t>(i));
+    ASSERT_EQ(RMW_RET_OK, rmw_take_request(service_, &request_header, &request, &taken));
+    ASSERT_TRUE(taken);
+  }
+
+  uint64_t reclaimed = 0U;
+  ASSERT_EQ(RMW_RET_OK, rmw_iceoryx_cpp::get_reclaimed_request_count(service_, &reclaimed));
+  EXPECT_EQ(1U, reclaimed);
+
+  EXPECT_EQ(
+    RMW_RET_INVALID_ARGUMENT,
+    rmw_iceoryx_cpp::set_held_request_reclamation(service_, -1, false));
+  rmw_reset_error();
+}
+
+TEST(ServiceLoanTest, non_fixed_size_requests_are_not_loaned)
+{
+  auto & environment = RmwRouDiEnvironment::instance();
+  auto ts = rosidl_typesupport_cpp::get_service_type_support_handle<test_msgs::srv::Arrays>();
+  auto client = rmw_create_client(
+    environment.node(), ts, "/service_loan_test", &rmw_qos_profile_services_default);
+  ASSERT_NE(nullptr, client) << rmw_get_error_string().str;
+
+  void * loaned_request = nullptr;
+  EXPECT_EQ(RMW_RET_UNSUPPORTED, rmw_iceoryx_cpp::borrow_loaned_request(client, &loaned_request));
+  EXPECT_EQ(nullptr, loaned_request);
+  rmw_reset_error();
+
+  EXPECT_EQ(RMW_RET_OK, rmw_destroy_client(environment.node(), client));
+}
@@ -0,0 +1,174 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RMW_ROUDI_ENVIRONMENT_HPP_
+#define RMW_ROUDI_ENVIRONMENT_HPP_
+
+#include <stdexcept>
+#include <string>
+
+#include "iceoryx_posh/testing/roudi_environment/roudi_environment.hpp"
+
+#include "rcutils/allocator.h"
+
+#include "rmw/error_handling.h"
+#include "rmw/init.h"
+#include "rmw/init_options.h"
+#include "rmw/rmw.h"
+
+/// @brief Time after which the wait helpers of the environment give up
+constexpr rmw_time_t DEFAULT_WAIT_TIMEOUT{1U, 0U};
+
+/// @brief RouDi running in this process with one rmw context and node on top of it, so that
+///        tests and benchmarks can use the rmw API without a RouDi daemon. iceoryx allows only
+///        one runtime per process, hence the environment is created on first use and lives
+///        until the process exits.
+class RmwRouDiEnvironment
+{
+public:
+  static RmwRouDiEnvironment & instance()
+  {
+    static RmwRouDiEnvironment environment;
+    return environment;
+  }
+
+  RmwRouDiEnvironment(const RmwRouDiEnvironment &) = delete;
+  RmwRouDiEnvironment & operator=(const RmwRouDiEnvironment &) = delete;
+
+  rmw_context_t * context()
+  {
+    return &context_;
+  }
+
+  rmw_node_t * node()
+  {
+    return node_;
+  }
+
+  /// @brief Let RouDi connect the ports which were created since the last call, a subscription
+  ///        receives samples only once it is connected
+  void discover()
+  {
+    roudi_.InterOpWait();
+  }
+
+  /// @brief Wait until the subscription has a sample
+  /// @return RMW_RET_OK if it is ready, RMW_RET_TIMEOUT if not or the error of 'rmw_wait'
+  static rmw_ret_t wait_for(
+    rmw_wait_set_t * wait_set,
+    const rmw_subscription_t * subscription,
+    const rmw_time_t & timeout = DEFAULT_WAIT_TIMEOUT)
+  {
+    void * handles[1] = {subscription->data};
+    rmw_subscriptions_t subscriptions{1U, handles};
+    rmw_services_t services{0U, nullptr};
+    rmw_clients_t clients{0U, nullptr};
+    rmw_events_t events{0U, nullptr};
+    return wait(wait_set, subscriptions, services, clients, events, handles, timeout);
+  }
+
+  /// @brief Wait until the service has a request
+  static rmw_ret_t wait_for(
+    rmw_wait_set_t * wait_set,
+    const rmw_service_t * service,
+    const rmw_time_t & timeout = DEFAULT_WAIT_TIMEOUT)
+  {
+    void * handles[1] = {service->data};
+    rmw_subscriptions_t subscriptions{0U, nullptr};
+    rmw_services_t services{1U, handles};
+    rmw_clients_t clients{0U, nullptr};
+    rmw_events_t events{0U, nullptr};
+    return wait(wait_set, subscriptions, services, clients, events, handles, timeout);
+  }
+
+  /// @brief Wait until the client has a response
+  static rmw_ret_t wait_for(
+    rmw_wait_set_t * wait_set,
+    const rmw_client_t * client,
+    const rmw_time_t & timeout = DEFAULT_WAIT_TIMEOUT)
+  {
+    void * handles[1] = {client->data};
+    rmw_subscriptions_t subscriptions{0U, nullptr};
+    rmw_services_t services{0U, nullptr};
+    rmw_clients_t clients{1U, handles};
+    rmw_events_t events{0U, nullptr};
+    return wait(wait_set, subscriptions, services, clients, events, handles, timeout);
+  }
+
+  /// @brief Wait until the event holds a status change
+  static rmw_ret_t wait_for(
+    rmw_wait_set_t * wait_set,
+    rmw_event_t * event,
+    const rmw_time_t & timeout = DEFAULT_WAIT_TIMEOUT)
+  {
+    void * handles[1] = {event};
+    rmw_subscriptions_t subscriptions{0U, nullptr};
+    rmw_services_t services{0U, nullptr};
+    rmw_clients_t clients{0U, nullptr};
+    rmw_events_t events{1U, handles};
+    return wait(wait_set, subscriptions, services, clients, events, handles, timeout);
+  }
+
+private:
+  static rmw_ret_t wait(
+    rmw_wait_set_t * wait_set,
+    rmw_subscriptions_t & subscriptions,
+    rmw_services_t & services,
+    rmw_clients_t & clients,
+    rmw_events_t & events,
+    void * const * handles,
+    const rmw_time_t & timeout)
+  {
+    rmw_guard_conditions_t guard_conditions{0U, nullptr};
+    auto ret = rmw_wait(
+      &subscriptions, &guard_conditions, &services, &clients, &events, wait_set, &timeout);
+    if (RMW_RET_OK == ret && !handles[0]) {
+      return RMW_RET_TIMEOUT;
+    }
+    return ret;
+  }
+
+  RmwRouDiEnvironment()
+  {
+    init_options_ = rmw_get_zero_initialized_init_options();
+    context_ = rmw_get_zero_initialized_context();
+    if (RMW_RET_OK != rmw_init_options_init(&init_options_, rcutils_get_default_allocator()) ||
+      RMW_RET_OK != rmw_init(&init_options_, &context_))
+    {
+      throw std::runtime_error(
+              std::string("failed to initialize rmw: ") + rmw_get_error_string().str);
+    }
+    node_ = rmw_create_node(&context_, "rmw_roudi_environment", "/");
+    if (!node_) {
+      throw std::runtime_error(
+              std::string("failed to create node: ") + rmw_get_error_string().str);
+    }
+  }
+
+  ~RmwRouDiEnvironment()
+  {
+    (void)rmw_destroy_node(node_);
+    (void)rmw_shutdown(&context_);
+    (void)rmw_context_fini(&context_);
+    (void)rmw_init_options_fini(&init_options_);
+  }
+
+  // RouDi is started first and stopped last
+  iox::roudi::RouDiEnvironment roudi_;
+  rmw_init_options_t init_options_;
+  rmw_context_t context_;
+  rmw_node_t * node_{nullptr};
+};
+
+#endif  // RMW_ROUDI_ENVIRONMENT_HPP_